@@ -0,0 +1,205 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "s21_kernels.h"
+#include "s21_matrix_oop.h"
+#include "s21_structured.h"
+
+// Timed regression gate. Every kernel is run PERF_REPEATS times, the best
+// time is compared against perf_baseline.txt and the gate fails if any kernel
+// got slower than baseline * tolerance (S21_PERF_TOLERANCE, default 1.5).
+//
+//   ./perf_test [baseline]           check against the baseline
+//   ./perf_test --update [baseline]  rewrite the baseline from this machine
+
+#define PERF_REPEATS 5
+#define DEFAULT_TOLERANCE 1.5
+#define DEFAULT_BASELINE "perf_baseline.txt"
+// solve_refined_512 must beat solve_double_512, the plain double LU solve
+// of the same system, by at least this factor on the same run
+#define MIN_REFINED_SPEEDUP 1.0
+
+struct PerfCase {
+  std::string name;
+  std::function<void()> run;
+};
+
+static S21Matrix random_matrix(int rows, int cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  S21Matrix matrix{rows, cols};
+  for (int row = 1; row <= rows; row++) {
+    for (int col = 1; col <= cols; col++) {
+      matrix.mutate_matrix_element(row, col, value(gen));
+    }
+  }
+  return matrix;
+}
+
+static S21Matrix random_regular(int size, unsigned seed) {
+  S21Matrix matrix = random_matrix(size, size, seed);
+  for (int i = 1; i <= size; i++) {
+    matrix.mutate_matrix_element(i, i, matrix(i, i) + size);
+  }
+  return matrix;
+}
+
+// Reference for SolveRefined: double LU and one solve, no refinement.
+static S21Matrix solve_double(const S21Matrix& a, const S21Matrix& rhs) {
+  const int size = a.get_matrix_rows(), rhs_cols = rhs.get_matrix_cols();
+  std::vector<double> lu(size * size), x(size * rhs_cols);
+  std::vector<int> pivots(size);
+  for (int row = 0; row < size; row++) {
+    for (int col = 0; col < size; col++) {
+      lu[row * size + col] = a.get_matrix_element(row + 1, col + 1);
+    }
+    for (int col = 0; col < rhs_cols; col++) {
+      x[col * size + row] = rhs.get_matrix_element(row + 1, col + 1);
+    }
+  }
+  lu_decompose(lu.data(), size, pivots.data());
+  lu_solve(lu.data(), size, pivots.data(), x.data(), rhs_cols);
+  S21Matrix solution(size, rhs_cols);
+  for (int row = 0; row < size; row++) {
+    for (int col = 0; col < rhs_cols; col++) {
+      solution.mutate_matrix_element(row + 1, col + 1, x[col * size + row]);
+    }
+  }
+  return solution;
+}
+
+static double best_time(const std::function<void()>& run) {
+  double best = 1e300;
+  for (int repeat = 0; repeat < PERF_REPEATS; repeat++) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    auto stop = std::chrono::steady_clock::now();
+    best = std::min(best, std::chrono::duration<double>(stop - start).count());
+  }
+  return best;
+}
+
+// Results are accumulated here so the optimizer cannot drop the work.
+static volatile double sink;
+
+static std::vector<PerfCase> perf_cases() {
+  static S21Matrix a256 = random_matrix(256, 256, 1);
+  static S21Matrix b256 = random_matrix(256, 256, 2);
+  static S21Matrix a512 = random_regular(512, 3);
+  static S21Matrix rhs512 = random_matrix(512, 4, 4);
+  static S21Matrix a128 = random_matrix(128, 128, 5) * (1.0 / 128);
+  static S21Matrix big = random_matrix(2048, 2048, 6);
+  static S21Matrix big_copy(big);
+  static S21Matrix rhs_long = random_matrix(200000, 1, 7);
+  static S21Matrix rhs_sym = random_matrix(512, 8, 8);
+  static S21BandedMatrix tridiagonal{200000, 1, 1};
+  static S21SymmetricMatrix symmetric{512};
+  for (int i = 1; i <= 200000; i++) {
+    tridiagonal.mutate_matrix_element(i, i, 4);
+    if (i > 1) tridiagonal.mutate_matrix_element(i, i - 1, -1);
+    if (i < 200000) tridiagonal.mutate_matrix_element(i, i + 1, -1);
+  }
+  for (int row = 1; row <= 512; row++) {
+    for (int col = 1; col <= row; col++) {
+      symmetric.mutate_matrix_element(row, col, a512(row, col));
+    }
+  }
+
+  return {
+      {"mul_matrix_256", [] { sink = (a256 * b256)(1, 1); }},
+      {"solve_refined_512", [] { sink = a512.SolveRefined(rhs512)(1, 1); }},
+      {"solve_double_512", [] { sink = solve_double(a512, rhs512)(1, 1); }},
+      {"log_determinant_512", [] { sink = a512.LogDeterminant().log_abs; }},
+      {"power_16_128", [] { sink = a128.Power(16)(1, 1); }},
+      {"exp_128", [] { sink = a128.Exp()(1, 1); }},
+      {"frobenius_2048", [] { sink = big.FrobeniusNorm(); }},
+      {"one_norm_2048", [] { sink = big.OneNorm(); }},
+      {"approx_equal_2048", [] { sink = big.ApproxEqual(big_copy); }},
+      {"tridiagonal_solve_200000",
+       [] { sink = tridiagonal.Solve(rhs_long)(1, 1); }},
+      {"symmetric_mul_512",
+       [] { sink = (symmetric * rhs_sym)(1, 1); }},
+  };
+}
+
+int main(int argc, char** argv) {
+  bool update = false;
+  std::string baseline_path = DEFAULT_BASELINE;
+  for (int i = 1; i < argc; i++) {
+    if (std::strcmp(argv[i], "--update") == 0) {
+      update = true;
+    } else {
+      baseline_path = argv[i];
+    }
+  }
+  const char* tolerance_env = std::getenv("S21_PERF_TOLERANCE");
+  const double tolerance =
+      tolerance_env ? std::atof(tolerance_env) : DEFAULT_TOLERANCE;
+
+  std::map<std::string, double> baseline;
+  std::ifstream input(baseline_path);
+  std::string line;
+  while (std::getline(input, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    size_t space = line.find(' ');
+    if (space == std::string::npos) continue;
+    baseline[line.substr(0, space)] = std::atof(line.c_str() + space + 1);
+  }
+
+  std::map<std::string, double> timings;
+  std::vector<std::pair<std::string, double>> results;
+  int regressions = 0;
+  for (const PerfCase& perf_case : perf_cases()) {
+    double seconds = best_time(perf_case.run);
+    results.push_back({perf_case.name, seconds});
+    timings[perf_case.name] = seconds;
+    auto it = baseline.find(perf_case.name);
+    std::cout << perf_case.name << ": " << seconds << " s";
+    if (it == baseline.end()) {
+      std::cout << " (no baseline)";
+    } else {
+      std::cout << " (baseline " << it->second << " s, x"
+                << seconds / it->second << ")";
+      if (!update && seconds > it->second * tolerance) {
+        std::cout << " REGRESSION";
+        regressions++;
+      }
+    }
+    std::cout << std::endl;
+  }
+
+  const double speedup =
+      timings["solve_double_512"] / timings["solve_refined_512"];
+  std::cout << "solve_refined_512 vs solve_double_512: x" << speedup;
+  if (speedup < MIN_REFINED_SPEEDUP) {
+    std::cout << " SLOWER THAN DOUBLE";
+    regressions++;
+  }
+  std::cout << std::endl;
+
+  if (update) {
+    std::ofstream output(baseline_path);
+    output << "# best of " << PERF_REPEATS
+           << " runs in seconds, regenerate with `make perf_baseline`\n";
+    for (const auto& result : results) {
+      output << result.first << " " << result.second << "\n";
+    }
+    std::cout << "baseline written to " << baseline_path << std::endl;
+    return 0;
+  }
+  if (regressions) {
+    std::cout << regressions << " kernel(s) slower than baseline x"
+              << tolerance << std::endl;
+    return 1;
+  }
+  return 0;
+}
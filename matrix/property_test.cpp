@@ -0,0 +1,404 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "s21_exceptions.h"
+#include "s21_matrix_oop.h"
+#include "s21_structured.h"
+
+// Randomized differential tests: every fast path is compared against a naive
+// reference over many random shapes, including 1xN, Nx1, odd sizes that do
+// not fill a SIMD lane or an LU block, and near-singular systems. Built with
+// optimizations and run without valgrind by `make property`.
+//
+// S21_PROPERTY_SEED and S21_PROPERTY_ROUNDS override the defaults below.
+
+#define DEFAULT_SEED 20240328u
+#define DEFAULT_ROUNDS 2000
+#define MAX_ULPS 64
+
+typedef std::vector<std::vector<long double>> Reference;
+
+static unsigned property_seed() {
+  const char* seed = std::getenv("S21_PROPERTY_SEED");
+  return seed ? (unsigned)std::strtoul(seed, nullptr, 10) : DEFAULT_SEED;
+}
+
+static int property_rounds() {
+  const char* rounds = std::getenv("S21_PROPERTY_ROUNDS");
+  return rounds ? std::atoi(rounds) : DEFAULT_ROUNDS;
+}
+
+// Sizes are skewed towards the edge cases: 1, odd sizes and the sizes just
+// around the 4-wide accumulators and the 64-wide LU/GEMM blocks.
+static int random_size(std::mt19937& gen, int max_size) {
+  static const int kEdges[] = {1, 2, 3, 4, 5, 7, 63, 64, 65};
+  std::uniform_int_distribution<int> pick(0, 3);
+  if (pick(gen) == 0) {
+    std::uniform_int_distribution<int> edge(0, 8);
+    int size = kEdges[edge(gen)];
+    if (size <= max_size) return size;
+  }
+  std::uniform_int_distribution<int> size(1, max_size);
+  return size(gen);
+}
+
+static S21Matrix random_matrix(std::mt19937& gen, int rows, int cols) {
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  S21Matrix matrix{rows, cols};
+  for (int row = 1; row <= rows; row++) {
+    for (int col = 1; col <= cols; col++) {
+      matrix.mutate_matrix_element(row, col, value(gen));
+    }
+  }
+  return matrix;
+}
+
+static Reference to_reference(const S21Matrix& matrix) {
+  Reference reference(matrix.get_matrix_rows(),
+                      std::vector<long double>(matrix.get_matrix_cols()));
+  for (int row = 0; row < matrix.get_matrix_rows(); row++) {
+    for (int col = 0; col < matrix.get_matrix_cols(); col++) {
+      reference[row][col] = matrix.get_matrix_element(row + 1, col + 1);
+    }
+  }
+  return reference;
+}
+
+static Reference naive_mul(const Reference& a, const Reference& b) {
+  Reference result(a.size(), std::vector<long double>(b[0].size(), 0.0L));
+  for (size_t i = 0; i < a.size(); i++) {
+    for (size_t j = 0; j < b[0].size(); j++) {
+      for (size_t k = 0; k < b.size(); k++) result[i][j] += a[i][k] * b[k][j];
+    }
+  }
+  return result;
+}
+
+static long double naive_determinant(Reference a) {
+  long double det = 1.0L;
+  const int size = (int)a.size();
+  for (int k = 0; k < size; k++) {
+    int pivot = k;
+    for (int i = k + 1; i < size; i++) {
+      if (std::fabs(a[i][k]) > std::fabs(a[pivot][k])) pivot = i;
+    }
+    if (a[pivot][k] == 0.0L) return 0.0L;
+    if (pivot != k) {
+      std::swap(a[pivot], a[k]);
+      det = -det;
+    }
+    det *= a[k][k];
+    for (int i = k + 1; i < size; i++) {
+      long double ratio = a[i][k] / a[k][k];
+      for (int j = k; j < size; j++) a[i][j] -= ratio * a[k][j];
+    }
+  }
+  return det;
+}
+
+static std::int64_t ulp_distance(double a, double b) {
+  if (a == b) return 0;
+  std::int64_t bits_a, bits_b;
+  std::memcpy(&bits_a, &a, sizeof(a));
+  std::memcpy(&bits_b, &b, sizeof(b));
+  if (bits_a < 0) bits_a = INT64_MIN - bits_a;
+  if (bits_b < 0) bits_b = INT64_MIN - bits_b;
+  return bits_a > bits_b ? bits_a - bits_b : bits_b - bits_a;
+}
+
+// |actual - expected| within MAX_ULPS of expected, or within an absolute
+// bound of scale * 1e-13 for values that cancel down to nearly zero
+static void expect_close(long double expected, double actual,
+                         long double scale) {
+  double rounded = (double)expected;
+  if (ulp_distance(rounded, actual) <= MAX_ULPS) return;
+  EXPECT_LE(std::fabs(expected - actual), scale * 1e-13L)
+      << "expected " << (double)expected << " got " << actual;
+}
+
+static void expect_matrix_close(const Reference& expected,
+                                const S21Matrix& actual, long double scale) {
+  ASSERT_EQ(expected.size(), (size_t)actual.get_matrix_rows());
+  ASSERT_EQ(expected[0].size(), (size_t)actual.get_matrix_cols());
+  for (int row = 0; row < actual.get_matrix_rows(); row++) {
+    for (int col = 0; col < actual.get_matrix_cols(); col++) {
+      expect_close(expected[row][col],
+                   actual.get_matrix_element(row + 1, col + 1), scale);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+TEST(property, mul_matrix_matches_naive) {
+  std::mt19937 gen(property_seed());
+  for (int round = 0; round < property_rounds(); round++) {
+    int rows = random_size(gen, 17), inner = random_size(gen, 17),
+        cols = random_size(gen, 17);
+    S21Matrix a = random_matrix(gen, rows, inner);
+    S21Matrix b = random_matrix(gen, inner, cols);
+    expect_matrix_close(naive_mul(to_reference(a), to_reference(b)), a * b,
+                        inner);
+  }
+}
+
+TEST(property, power_matches_repeated_mul) {
+  std::mt19937 gen(property_seed() + 1);
+  std::uniform_int_distribution<int> power(0, 9);
+  for (int round = 0; round < property_rounds() / 10; round++) {
+    int size = random_size(gen, 70);
+    S21Matrix a = random_matrix(gen, size, size);
+    a *= 1.0 / size;
+    int k = power(gen);
+    Reference expected(size, std::vector<long double>(size, 0.0L));
+    for (int i = 0; i < size; i++) expected[i][i] = 1.0L;
+    for (int i = 0; i < k; i++) expected = naive_mul(expected, to_reference(a));
+    expect_matrix_close(expected, a.Power(k), 1.0L);
+  }
+}
+
+TEST(property, solve_refined_residual) {
+  std::mt19937 gen(property_seed() + 2);
+  for (int round = 0; round < property_rounds() / 10; round++) {
+    int size = random_size(gen, 70), cols = random_size(gen, 3);
+    S21Matrix a = random_matrix(gen, size, size);
+    S21Matrix b = random_matrix(gen, size, cols);
+    if (round % 4 == 0 && size > 1) {
+      // near-singular: the last row almost repeats the first one
+      for (int col = 1; col <= size; col++) {
+        a.mutate_matrix_element(size, col, a(1, col) * (1 + 1e-9));
+      }
+    }
+    S21Matrix x{1, 1};
+    try {
+      x = a.SolveRefined(b);
+    } catch (const DeterminantZeroException&) {
+      continue;
+    }
+    Reference residual = naive_mul(to_reference(a), to_reference(x));
+    long double x_norm = 0.0L, a_norm = 0.0L;
+    for (int row = 0; row < size; row++) {
+      long double row_sum = 0.0L;
+      for (int col = 1; col <= size; col++) {
+        row_sum += std::fabs(a(row + 1, col));
+      }
+      if (row_sum > a_norm) a_norm = row_sum;
+      for (int col = 0; col < cols; col++) {
+        if (std::fabs(x(row + 1, col + 1)) > x_norm) {
+          x_norm = std::fabs(x(row + 1, col + 1));
+        }
+      }
+    }
+    for (int row = 0; row < size; row++) {
+      for (int col = 0; col < cols; col++) {
+        EXPECT_LE(std::fabs(residual[row][col] - b(row + 1, col + 1)),
+                  a_norm * x_norm * size * 4e-16L);
+      }
+    }
+  }
+}
+
+TEST(property, log_determinant_matches_naive) {
+  std::mt19937 gen(property_seed() + 3);
+  for (int round = 0; round < property_rounds() / 10; round++) {
+    int size = random_size(gen, 90);
+    S21Matrix a = random_matrix(gen, size, size);
+    long double expected = naive_determinant(to_reference(a));
+    // A backward-stable elimination perturbs det by about n * eps times the
+    // Hadamard bound (product of the row norms), not by eps * |det|.
+    long double hadamard = 1.0L;
+    for (int row = 1; row <= size; row++) {
+      long double norm = 0.0L;
+      for (int col = 1; col <= size; col++) norm += a(row, col) * a(row, col);
+      hadamard *= std::sqrt(norm);
+    }
+    const long double bound = hadamard * size * 1e-14L;
+    S21LogDeterminant log_det = a.LogDeterminant();
+    EXPECT_LE(std::fabs(log_det.sign * std::exp((long double)log_det.log_abs) -
+                        expected),
+              bound);
+    if (std::fabs(expected) > bound) {
+      EXPECT_EQ(expected > 0 ? 1 : -1, log_det.sign);
+    }
+    if (size <= 12) {
+      EXPECT_LE(std::fabs(a.Determinant() - expected), bound);
+    }
+  }
+}
+
+TEST(property, reductions_match_naive) {
+  std::mt19937 gen(property_seed() + 4);
+  for (int round = 0; round < property_rounds(); round++) {
+    int rows = random_size(gen, 65), cols = random_size(gen, 65);
+    S21Matrix a = random_matrix(gen, rows, cols);
+    S21Matrix b = random_matrix(gen, rows, cols);
+    long double frobenius = 0.0L, dot = 0.0L, max_abs = 0.0L, one = 0.0L,
+                inf = 0.0L;
+    std::vector<long double> row_sums(rows, 0.0L), col_sums(cols, 0.0L),
+        col_abs(cols, 0.0L);
+    for (int row = 0; row < rows; row++) {
+      long double row_abs = 0.0L;
+      for (int col = 0; col < cols; col++) {
+        long double value = a(row + 1, col + 1);
+        frobenius += value * value;
+        dot += value * b(row + 1, col + 1);
+        if (std::fabs(value) > max_abs) max_abs = std::fabs(value);
+        row_sums[row] += value;
+        col_sums[col] += value;
+        col_abs[col] += std::fabs(value);
+        row_abs += std::fabs(value);
+      }
+      if (row_abs > inf) inf = row_abs;
+    }
+    for (int col = 0; col < cols; col++) {
+      if (col_abs[col] > one) one = col_abs[col];
+    }
+    const long double scale = rows * cols;
+    expect_close(std::sqrt(frobenius), a.FrobeniusNorm(), 1.0L);
+    expect_close(dot, a.Dot(b), scale);
+    EXPECT_DOUBLE_EQ((double)max_abs, a.MaxAbs());
+    expect_close(one, a.OneNorm(), scale);
+    expect_close(inf, a.InfNorm(), scale);
+    S21Matrix a_row_sums = a.RowSums(), a_col_sums = a.ColSums();
+    for (int row = 0; row < rows; row++) {
+      expect_close(row_sums[row], a_row_sums(row + 1, 1), cols);
+    }
+    for (int col = 0; col < cols; col++) {
+      expect_close(col_sums[col], a_col_sums(1, col + 1), rows);
+    }
+    if (rows == cols) {
+      long double trace = 0.0L;
+      for (int i = 1; i <= rows; i++) trace += a(i, i);
+      expect_close(trace, a.Trace(), rows);
+    }
+
+    // a single NaN anywhere must reach every norm
+    std::uniform_int_distribution<int> row_pick(1, rows), col_pick(1, cols);
+    a.mutate_matrix_element(row_pick(gen), col_pick(gen), NAN);
+    EXPECT_TRUE(std::isnan(a.MaxAbs()));
+    EXPECT_TRUE(std::isnan(a.FrobeniusNorm()));
+    EXPECT_TRUE(std::isnan(a.OneNorm()));
+    EXPECT_TRUE(std::isnan(a.InfNorm()));
+  }
+}
+
+TEST(property, approx_equal_matches_naive) {
+  std::mt19937 gen(property_seed() + 5);
+  std::uniform_real_distribution<double> noise(-2e-8, 2e-8);
+  for (int round = 0; round < property_rounds(); round++) {
+    int rows = random_size(gen, 65), cols = random_size(gen, 65);
+    S21Matrix a = random_matrix(gen, rows, cols);
+    S21Matrix b(a);
+    bool expected = true, exact = true;
+    for (int row = 1; row <= rows; row++) {
+      for (int col = 1; col <= cols; col++) {
+        if (round % 2) {
+          b.mutate_matrix_element(row, col, a(row, col) + noise(gen));
+        }
+        if (std::fabs(a(row, col) - b(row, col)) >
+            1e-8 + 1e-5 * std::fabs(b(row, col))) {
+          expected = false;
+        }
+        if (a(row, col) != b(row, col)) exact = false;
+      }
+    }
+    EXPECT_EQ(expected, a.ApproxEqual(b, 1e-5, 1e-8));
+    EXPECT_EQ(exact, a.EqMatrix(b));
+  }
+}
+
+TEST(property, structured_matches_dense) {
+  std::mt19937 gen(property_seed() + 6);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  for (int round = 0; round < property_rounds() / 4; round++) {
+    int size = random_size(gen, 40), cols = random_size(gen, 5);
+    std::uniform_int_distribution<int> band(0, size - 1);
+    S21BandedMatrix banded{size, band(gen) % 4, band(gen) % 4};
+    S21TriangularMatrix triangular{size, round % 2 == 0};
+    S21SymmetricMatrix symmetric{size};
+    S21DiagonalMatrix diagonal{size};
+    for (int row = 1; row <= size; row++) {
+      diagonal.mutate_matrix_element(row, row, 1 + value(gen) / 2);
+      for (int col = 1; col <= size; col++) {
+        double bonus = row == col ? size : 0.0;
+        if (col - row <= banded.get_upper_bandwidth() &&
+            row - col <= banded.get_lower_bandwidth()) {
+          banded.mutate_matrix_element(row, col, value(gen) + bonus);
+        }
+        if (triangular.is_upper() ? col >= row : col <= row) {
+          triangular.mutate_matrix_element(row, col, value(gen) + bonus);
+        }
+        if (col <= row) {
+          symmetric.mutate_matrix_element(row, col, value(gen) + bonus);
+        }
+      }
+    }
+    S21Matrix rhs = random_matrix(gen, size, cols);
+    S21Matrix lhs = random_matrix(gen, cols, size);
+
+    S21Matrix dense = banded.ToDense();
+    expect_matrix_close(naive_mul(to_reference(dense), to_reference(rhs)),
+                        banded * rhs, size);
+    expect_matrix_close(naive_mul(to_reference(lhs), to_reference(dense)),
+                        lhs * banded, size);
+    expect_matrix_close(to_reference(rhs), dense * banded.Solve(rhs), size);
+    expect_close(naive_determinant(to_reference(dense)), banded.Determinant(),
+                 std::fabs(naive_determinant(to_reference(dense))));
+
+    dense = triangular.ToDense();
+    expect_matrix_close(naive_mul(to_reference(dense), to_reference(rhs)),
+                        triangular * rhs, size);
+    expect_matrix_close(naive_mul(to_reference(lhs), to_reference(dense)),
+                        lhs * triangular, size);
+    expect_matrix_close(to_reference(rhs), dense * triangular.Solve(rhs),
+                        size);
+
+    dense = symmetric.ToDense();
+    expect_matrix_close(naive_mul(to_reference(dense), to_reference(rhs)),
+                        symmetric * rhs, size);
+    expect_matrix_close(naive_mul(to_reference(lhs), to_reference(dense)),
+                        lhs * symmetric, size);
+    expect_matrix_close(to_reference(rhs), dense * symmetric.Solve(rhs), size);
+
+    dense = diagonal.ToDense();
+    expect_matrix_close(naive_mul(to_reference(dense), to_reference(rhs)),
+                        diagonal * rhs, 1.0L);
+    expect_matrix_close(to_reference(rhs), dense * diagonal.Solve(rhs), 1.0L);
+  }
+}
+
+TEST(property, exp_and_polynomial_match_series) {
+  std::mt19937 gen(property_seed() + 7);
+  for (int round = 0; round < property_rounds() / 20; round++) {
+    int size = random_size(gen, 20);
+    S21Matrix a = random_matrix(gen, size, size);
+    a *= 2.0 / size;
+    // truncated Taylor series, converged to long double precision
+    Reference series(size, std::vector<long double>(size, 0.0L));
+    Reference term(size, std::vector<long double>(size, 0.0L));
+    for (int i = 0; i < size; i++) series[i][i] = term[i][i] = 1.0L;
+    Reference base = to_reference(a);
+    std::vector<double> coefficients(1, 1.0);
+    for (int k = 1; k <= 40; k++) {
+      term = naive_mul(term, base);
+      for (auto& row : term) {
+        for (auto& value : row) value /= k;
+      }
+      for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) series[i][j] += term[i][j];
+      }
+      coefficients.push_back(coefficients.back() / k);
+    }
+    expect_matrix_close(series, a.Exp(), 1e3L);
+    expect_matrix_close(series, a.Polynomial(coefficients), 1e3L);
+  }
+}
@@ -0,0 +1,173 @@
+#include <algorithm>
+
+#include "s21_exceptions.h"
+#include "s21_kernels.h"
+#include "s21_structured.h"
+
+// Row i of the band keeps columns i - lower_ .. i + upper_, element (i, j) is
+// stored at band_[i * width + j - i + lower_].
+
+S21BandedMatrix::S21BandedMatrix(int size, int lower, int upper)
+    : size_(size), lower_(lower), upper_(upper) {
+  if (size_ < 1 || lower_ < 0 || upper_ < 0 || lower_ >= size_ ||
+      upper_ >= size_) {
+    throw IndexOutOfBoundsException();
+  }
+  band_.assign(size_ * (lower_ + upper_ + 1), 0.0);
+}
+
+int S21BandedMatrix::get_matrix_size() const noexcept { return size_; }
+
+int S21BandedMatrix::get_lower_bandwidth() const noexcept { return lower_; }
+
+int S21BandedMatrix::get_upper_bandwidth() const noexcept { return upper_; }
+
+double S21BandedMatrix::get_matrix_element(int row, int col) const {
+  if (row < 1 || col < 1 || row > size_ || col > size_) {
+    throw IndexOutOfBoundsException();
+  }
+  if (col - row > upper_ || row - col > lower_) return 0.0;
+  return band_[(row - 1) * (lower_ + upper_ + 1) + col - row + lower_];
+}
+
+void S21BandedMatrix::mutate_matrix_element(int row, int col, double val) {
+  if (row < 1 || col < 1 || row > size_ || col > size_ ||
+      col - row > upper_ || row - col > lower_) {
+    throw IndexOutOfBoundsException();
+  }
+  band_[(row - 1) * (lower_ + upper_ + 1) + col - row + lower_] = val;
+}
+
+S21Matrix S21BandedMatrix::ToDense() const {
+  const int width = lower_ + upper_ + 1;
+  S21Matrix dense(size_, size_);
+  for (int i = 0; i < size_; ++i) {
+    int first = std::max(0, i - lower_), last = std::min(size_ - 1, i + upper_);
+    for (int j = first; j <= last; ++j) {
+      dense.matrix_[i * size_ + j] = band_[i * width + j - i + lower_];
+    }
+  }
+  return dense;
+}
+
+S21Matrix S21BandedMatrix::operator*(const S21Matrix &other) const {
+  if (size_ != other.rows_) throw ColumnRowMismatchException();
+  const int width = lower_ + upper_ + 1;
+  const int cols = other.cols_;
+  S21Matrix result(size_, cols);
+  for (int i = 0; i < size_; ++i) {
+    int first = std::max(0, i - lower_), last = std::min(size_ - 1, i + upper_);
+    for (int j = first; j <= last; ++j) {
+      kernel_axpy(band_[i * width + j - i + lower_], other.matrix_ + j * cols,
+                  result.matrix_ + i * cols, cols);
+    }
+  }
+  return result;
+}
+
+S21Matrix operator*(const S21Matrix &lhs, const S21BandedMatrix &rhs) {
+  if (lhs.cols_ != rhs.size_) throw ColumnRowMismatchException();
+  const int size = rhs.size_, lower = rhs.lower_;
+  const int width = lower + rhs.upper_ + 1;
+  S21Matrix result(lhs.rows_, size);
+  for (int row = 0; row < lhs.rows_; ++row) {
+    double *result_row = result.matrix_ + row * size;
+    for (int i = 0; i < size; ++i) {
+      int first = std::max(0, i - lower);
+      int last = std::min(size - 1, i + rhs.upper_);
+      kernel_axpy(lhs.matrix_[row * size + i],
+                  rhs.band_.data() + i * width + first - i + lower,
+                  result_row + first, last - first + 1);
+    }
+  }
+  return result;
+}
+
+// Banded LU with partial pivoting. Row swaps let U grow lower_ extra
+// superdiagonals, so `work` uses rows of 2 * lower_ + upper_ + 1 elements
+// with (i, j) at work[i * width + j - i + lower_]. The multipliers of step k
+// are kept apart in multipliers[k * lower_ .. k * lower_ + lower_).
+bool S21BandedMatrix::Factorize(std::vector<double> &work,
+                                std::vector<double> &multipliers,
+                                std::vector<int> &pivots) const {
+  const int band_width = lower_ + upper_ + 1;
+  const int width = 2 * lower_ + upper_ + 1;
+  work.assign(size_ * width, 0.0);
+  multipliers.assign(size_ * lower_, 0.0);
+  pivots.assign(size_, 0);
+  for (int i = 0; i < size_; ++i) {
+    std::copy(band_.begin() + i * band_width,
+              band_.begin() + (i + 1) * band_width, work.begin() + i * width);
+  }
+
+  auto at = [&](int i, int j) -> double & {
+    return work[i * width + j - i + lower_];
+  };
+  for (int k = 0; k < size_; ++k) {
+    const int last_row = std::min(size_ - 1, k + lower_);
+    const int last_col = std::min(size_ - 1, k + lower_ + upper_);
+    int max_row = k;
+    for (int i = k + 1; i <= last_row; ++i) {
+      if (std::abs(at(i, k)) > std::abs(at(max_row, k))) max_row = i;
+    }
+    pivots[k] = max_row;
+    if (at(max_row, k) == 0.0 || !std::isfinite(at(max_row, k))) return false;
+    if (max_row != k) {
+      for (int j = k; j <= last_col; ++j) std::swap(at(k, j), at(max_row, j));
+    }
+    for (int i = k + 1; i <= last_row; ++i) {
+      double ratio = at(i, k) / at(k, k);
+      multipliers[k * lower_ + i - k - 1] = ratio;
+      at(i, k) = 0.0;
+      if (last_col > k) {
+        kernel_axpy(-ratio, &at(k, k + 1), &at(i, k + 1), last_col - k);
+      }
+    }
+  }
+  return true;
+}
+
+S21Matrix S21BandedMatrix::Solve(const S21Matrix &rhs) const {
+  if (size_ != rhs.rows_) throw ColumnRowMismatchException();
+  std::vector<double> work, multipliers;
+  std::vector<int> pivots;
+  if (!Factorize(work, multipliers, pivots)) throw DeterminantZeroException();
+
+  const int width = 2 * lower_ + upper_ + 1;
+  const int cols = rhs.cols_;
+  S21Matrix result(rhs);
+  double *x = result.matrix_;
+  for (int k = 0; k < size_; ++k) {
+    if (pivots[k] != k) {
+      std::swap_ranges(x + k * cols, x + (k + 1) * cols, x + pivots[k] * cols);
+    }
+    const int last_row = std::min(size_ - 1, k + lower_);
+    for (int i = k + 1; i <= last_row; ++i) {
+      kernel_axpy(-multipliers[k * lower_ + i - k - 1], x + k * cols,
+                  x + i * cols, cols);
+    }
+  }
+  for (int i = size_ - 1; i >= 0; --i) {
+    const double *u_row = work.data() + i * width - i + lower_;
+    const int last_col = std::min(size_ - 1, i + lower_ + upper_);
+    for (int j = i + 1; j <= last_col; ++j) {
+      kernel_axpy(-u_row[j], x + j * cols, x + i * cols, cols);
+    }
+    for (int col = 0; col < cols; ++col) x[i * cols + col] /= u_row[i];
+  }
+  return result;
+}
+
+double S21BandedMatrix::Determinant() const {
+  std::vector<double> work, multipliers;
+  std::vector<int> pivots;
+  if (!Factorize(work, multipliers, pivots)) return 0.0;
+
+  const int width = 2 * lower_ + upper_ + 1;
+  double det = 1.0;
+  for (int i = 0; i < size_; ++i) {
+    det *= work[i * width + lower_];
+    if (pivots[i] != i) det = -det;
+  }
+  return det;
+}
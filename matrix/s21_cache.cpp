@@ -0,0 +1,96 @@
+#include "s21_cache.h"
+
+S21MatrixCache::S21MatrixCache()
+    : enabled_(false),
+      capacity_(0),
+      bytes_(0),
+      hits_(0),
+      misses_(0),
+      evictions_(0) {}
+
+S21MatrixCache &S21MatrixCache::Instance() {
+  static S21MatrixCache cache;
+  return cache;
+}
+
+void S21MatrixCache::Enable(std::size_t capacity_bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  capacity_ = capacity_bytes;
+  EvictLocked(capacity_);
+  enabled_ = true;
+}
+
+void S21MatrixCache::Disable() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  enabled_ = false;
+  EvictLocked(0);
+}
+
+bool S21MatrixCache::IsEnabled() const noexcept { return enabled_; }
+
+void S21MatrixCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  index_.clear();
+  bytes_ = 0;
+}
+
+S21CacheStats S21MatrixCache::GetStats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return {hits_, misses_, evictions_, entries_.size(), bytes_, capacity_};
+}
+
+void S21MatrixCache::ResetStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  hits_ = misses_ = evictions_ = 0;
+}
+
+void S21MatrixCache::EvictLocked(std::size_t capacity) {
+  while (bytes_ > capacity && !entries_.empty()) {
+    auto victim = std::prev(entries_.end());
+    auto range = index_.equal_range(victim->hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == victim) {
+        index_.erase(it);
+        break;
+      }
+    }
+    bytes_ -= victim->bytes;
+    entries_.erase(victim);
+    ++evictions_;
+  }
+}
+
+bool S21MatrixCache::Lookup(S21CachedOperation operation, const S21Matrix &key,
+                            S21Matrix &value) {
+  std::uint64_t hash = key.get_content_hash();
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto range = index_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    Entry &entry = *it->second;
+    if (entry.operation == operation && entry.key.IsBitwiseEqual(key)) {
+      entries_.splice(entries_.begin(), entries_, it->second);
+      value = entry.value;
+      ++hits_;
+      return true;
+    }
+  }
+  ++misses_;
+  return false;
+}
+
+void S21MatrixCache::Insert(S21CachedOperation operation, const S21Matrix &key,
+                            const S21Matrix &value) {
+  std::size_t bytes = sizeof(Entry) + sizeof(double) *
+                                          (key.get_matrix_rows() *
+                                               key.get_matrix_cols() +
+                                           value.get_matrix_rows() *
+                                               value.get_matrix_cols());
+  std::uint64_t hash = key.get_content_hash();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!enabled_ || bytes > capacity_) return;
+  entries_.push_front(Entry{operation, hash, key, value, bytes});
+  index_.emplace(hash, entries_.begin());
+  bytes_ += bytes;
+  EvictLocked(capacity_);
+}
@@ -0,0 +1,69 @@
+#ifndef S21_CACHE_H
+#define S21_CACHE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "s21_matrix_oop.h"
+
+enum class S21CachedOperation { kDeterminant, kComplements, kInverse };
+
+struct S21CacheStats {
+  std::uint64_t hits;
+  std::uint64_t misses;
+  std::uint64_t evictions;
+  std::size_t entries;
+  std::size_t bytes;
+  std::size_t capacity;
+};
+
+// Opt-in, process-wide memo of the expensive S21Matrix operations. Entries
+// are keyed on S21Matrix::get_content_hash() and hold a copy of the input
+// matrix, so a hit requires an exact element-wise match and any mutation of
+// the matrix simply stops matching. Memory is bounded by an LRU policy over
+// the bytes of stored inputs and results. Disabled by default.
+class S21MatrixCache {
+ private:
+  struct Entry {
+    S21CachedOperation operation;
+    std::uint64_t hash;
+    S21Matrix key;
+    S21Matrix value;  // a 1x1 matrix for scalar results
+    std::size_t bytes;
+  };
+
+  std::list<Entry> entries_;  // most recently used first
+  std::unordered_multimap<std::uint64_t, std::list<Entry>::iterator> index_;
+  std::atomic<bool> enabled_;
+  std::size_t capacity_;
+  std::size_t bytes_;
+  std::uint64_t hits_;
+  std::uint64_t misses_;
+  std::uint64_t evictions_;
+  mutable std::mutex mutex_;
+
+  S21MatrixCache();
+  void EvictLocked(std::size_t capacity);
+
+ public:
+  static S21MatrixCache& Instance();
+
+  void Enable(std::size_t capacity_bytes);
+  void Disable();  // also drops every entry
+  bool IsEnabled() const noexcept;
+  void Clear();
+  S21CacheStats GetStats() const;
+  void ResetStats();
+
+  // Copies the stored result into value on a hit.
+  bool Lookup(S21CachedOperation operation, const S21Matrix& key,
+              S21Matrix& value);
+  void Insert(S21CachedOperation operation, const S21Matrix& key,
+              const S21Matrix& value);
+};
+
+#endif
@@ -4,10 +4,12 @@
 S21Matrix::S21Matrix() {
   rows_ = 3;
   cols_ = 3;
+  hash_ = HASH_UNSET;
   matrix_ = new double[rows_ * cols_]();
 }
 
-S21Matrix::S21Matrix(int rows, int cols) : rows_(rows), cols_(cols) {
+S21Matrix::S21Matrix(int rows, int cols)
+    : rows_(rows), cols_(cols), hash_(HASH_UNSET) {
   if (rows_ < 1 || cols_ < 1) {
     throw IndexOutOfBoundsException();
   }
@@ -22,21 +24,25 @@ S21Matrix::S21Matrix(int rows, int cols) : rows_(rows), cols_(cols) {
 S21Matrix::S21Matrix(const S21Matrix &other) {
   rows_ = other.rows_;
   cols_ = other.cols_;
+  hash_ = HASH_UNSET;
   matrix_ = new double[rows_ * cols_]();
   std::memcpy(matrix_, other.matrix_, rows_ * cols_ * sizeof(double));
 }
 
-S21Matrix::S21Matrix(S21Matrix &&other) {
+S21Matrix::S21Matrix(S21Matrix &&other) noexcept {
   rows_ = other.rows_;
   cols_ = other.cols_;
-  matrix_ = new double[rows_ * cols_]();
-  std::memcpy(matrix_, other.matrix_, rows_ * cols_ * sizeof(double));
-  other.~S21Matrix();
+  hash_ = HASH_UNSET;
+  matrix_ = other.matrix_;
+  other.matrix_ = nullptr;
+  other.rows_ = 0;
+  other.cols_ = 0;
 }
 
-S21Matrix::~S21Matrix() {
+S21Matrix::~S21Matrix() noexcept {
   if (this->matrix_) delete[] matrix_;
   this->matrix_ = nullptr;
   this->rows_ = 0;
   this->cols_ = 0;
+  this->hash_ = HASH_UNSET;
 }
\ No newline at end of file
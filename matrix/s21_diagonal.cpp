@@ -0,0 +1,74 @@
+#include "s21_exceptions.h"
+#include "s21_structured.h"
+
+S21DiagonalMatrix::S21DiagonalMatrix(int size) : size_(size) {
+  if (size_ < 1) throw IndexOutOfBoundsException();
+  diagonal_.assign(size_, 0.0);
+}
+
+int S21DiagonalMatrix::get_matrix_size() const noexcept { return size_; }
+
+double S21DiagonalMatrix::get_matrix_element(int row, int col) const {
+  if (row < 1 || col < 1 || row > size_ || col > size_) {
+    throw IndexOutOfBoundsException();
+  }
+  return row == col ? diagonal_[row - 1] : 0.0;
+}
+
+void S21DiagonalMatrix::mutate_matrix_element(int row, int col, double val) {
+  if (row < 1 || row > size_ || col != row) {
+    throw IndexOutOfBoundsException();
+  }
+  diagonal_[row - 1] = val;
+}
+
+S21Matrix S21DiagonalMatrix::ToDense() const {
+  S21Matrix dense(size_, size_);
+  for (int i = 0; i < size_; ++i) {
+    dense.matrix_[i * size_ + i] = diagonal_[i];
+  }
+  return dense;
+}
+
+S21Matrix S21DiagonalMatrix::operator*(const S21Matrix &other) const {
+  if (size_ != other.rows_) throw ColumnRowMismatchException();
+  S21Matrix result(other);
+  for (int row = 0; row < size_; ++row) {
+    double *result_row = result.matrix_ + row * result.cols_;
+    for (int col = 0; col < result.cols_; ++col) {
+      result_row[col] *= diagonal_[row];
+    }
+  }
+  return result;
+}
+
+S21Matrix operator*(const S21Matrix &lhs, const S21DiagonalMatrix &rhs) {
+  if (lhs.cols_ != rhs.size_) throw ColumnRowMismatchException();
+  S21Matrix result(lhs);
+  for (int row = 0; row < result.rows_; ++row) {
+    double *result_row = result.matrix_ + row * result.cols_;
+    for (int col = 0; col < result.cols_; ++col) {
+      result_row[col] *= rhs.diagonal_[col];
+    }
+  }
+  return result;
+}
+
+S21Matrix S21DiagonalMatrix::Solve(const S21Matrix &rhs) const {
+  if (size_ != rhs.rows_) throw ColumnRowMismatchException();
+  S21Matrix result(rhs);
+  for (int row = 0; row < size_; ++row) {
+    if (diagonal_[row] == 0.0) throw DeterminantZeroException();
+    double *result_row = result.matrix_ + row * result.cols_;
+    for (int col = 0; col < result.cols_; ++col) {
+      result_row[col] /= diagonal_[row];
+    }
+  }
+  return result;
+}
+
+double S21DiagonalMatrix::Determinant() const noexcept {
+  double det = 1.0;
+  for (int i = 0; i < size_; ++i) det *= diagonal_[i];
+  return det;
+}
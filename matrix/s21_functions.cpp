@@ -0,0 +1,263 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "s21_exceptions.h"
+#include "s21_kernels.h"
+#include "s21_matrix_oop.h"
+
+// All functions below work on a fixed set of n x n workspace buffers that are
+// allocated up front; products are written into a spare buffer and swapped
+// in, so no allocation happens inside the evaluation loops.
+
+static void set_identity(std::vector<double> &buffer, int size,
+                         double scale = 1.0) {
+  buffer.assign(size * size, 0.0);
+  for (int i = 0; i < size; ++i) buffer[i * size + i] = scale;
+}
+
+// target = a * b, using spare as the product buffer
+static void multiply_into(std::vector<double> &target, const double *a,
+                          const double *b, std::vector<double> &spare,
+                          int size) {
+  kernel_gemm(a, b, spare.data(), size, size, size);
+  target.swap(spare);
+}
+
+static double one_norm(const std::vector<double> &buffer, int size) {
+  double norm = 0.0;
+  for (int col = 0; col < size; ++col) {
+    double sum = 0.0;
+    for (int row = 0; row < size; ++row) {
+      sum += std::abs(buffer[row * size + col]);
+    }
+    if (sum > norm) norm = sum;
+  }
+  return norm;
+}
+
+static void transpose_in_place(std::vector<double> &buffer, int size) {
+  for (int row = 0; row < size; ++row) {
+    for (int col = row + 1; col < size; ++col) {
+      std::swap(buffer[row * size + col], buffer[col * size + row]);
+    }
+  }
+}
+
+// Overwrites rhs with lhs^-1 * rhs, lhs is destroyed. lu_solve takes the
+// right-hand side column-major, i.e. transposed for a row-major buffer.
+static void solve_in_place(std::vector<double> &lhs, std::vector<double> &rhs,
+                           int size) {
+  std::vector<int> pivots(size);
+  if (!lu_decompose(lhs.data(), size, pivots.data())) {
+    throw DeterminantZeroException();
+  }
+  transpose_in_place(rhs, size);
+  lu_solve(lhs.data(), size, pivots.data(), rhs.data(), size);
+  transpose_in_place(rhs, size);
+}
+
+S21Matrix S21Matrix::Power(int power) const {
+  if (rows_ != cols_) throw NonSquareMatrixException();
+
+  const int size = rows_;
+  std::vector<double> base(matrix_, matrix_ + size * size);
+  std::vector<double> result, spare(size * size);
+  // widened before negation, -INT_MIN does not fit in an int
+  long long exponent = power;
+  if (exponent < 0) {
+    std::vector<double> lu(base);
+    set_identity(base, size);
+    solve_in_place(lu, base, size);
+    exponent = -exponent;
+  }
+
+  // Binary exponentiation; result starts as the first odd power of base
+  // instead of the identity to save one product.
+  bool started = false;
+  while (exponent > 0) {
+    if (exponent & 1) {
+      if (started) {
+        multiply_into(result, result.data(), base.data(), spare, size);
+      } else {
+        result = base;
+        started = true;
+      }
+    }
+    exponent >>= 1;
+    if (exponent > 0) {
+      multiply_into(base, base.data(), base.data(), spare, size);
+    }
+  }
+  if (!started) set_identity(result, size);
+
+  S21Matrix power_matrix(size, size);
+  std::memcpy(power_matrix.matrix_, result.data(),
+              size * size * sizeof(double));
+  return power_matrix;
+}
+
+// Pade coefficients and the 1-norm bounds theta_m below which the [m/m]
+// approximant reaches double precision, from Higham, "The Scaling and
+// Squaring Method for the Matrix Exponential Revisited" (2005).
+static const double kPade3[] = {120.0, 60.0, 12.0, 1.0};
+static const double kPade5[] = {30240.0, 15120.0, 3360.0, 420.0, 30.0, 1.0};
+static const double kPade7[] = {17297280.0, 8648640.0, 1995840.0, 277200.0,
+                                25200.0,    1512.0,    56.0,      1.0};
+static const double kPade9[] = {17643225600.0, 8821612800.0, 2075673600.0,
+                                302702400.0,   30270240.0,   2162160.0,
+                                110880.0,      3960.0,       90.0,
+                                1.0};
+static const double kPade13[] = {64764752532480000.0,
+                                 32382376266240000.0,
+                                 7771770303897600.0,
+                                 1187353796428800.0,
+                                 129060195264000.0,
+                                 10559470521600.0,
+                                 670442572800.0,
+                                 33522128640.0,
+                                 1323241920.0,
+                                 40840800.0,
+                                 960960.0,
+                                 16380.0,
+                                 182.0,
+                                 1.0};
+static const double kTheta[] = {1.495585217958292e-2, 2.539398330063230e-1,
+                                9.504178996162932e-1, 2.097847961257068,
+                                5.371920351148152};
+
+S21Matrix S21Matrix::Exp() const {
+  if (rows_ != cols_) throw NonSquareMatrixException();
+
+  const int size = rows_;
+  const int total = size * size;
+  std::vector<double> a(matrix_, matrix_ + total);
+  std::vector<double> a2(total), a4(total), a6(total), u(total), v(total);
+  std::vector<double> spare(total);
+
+  const double norm = one_norm(a, size);
+  // No scaling brings an infinite or NaN norm into the Pade range.
+  if (!std::isfinite(norm)) {
+    S21Matrix nan_matrix(size, size);
+    std::fill(nan_matrix.matrix_, nan_matrix.matrix_ + total,
+              std::numeric_limits<double>::quiet_NaN());
+    return nan_matrix;
+  }
+  const double *coeffs = kPade13;
+  int degree = 13, squarings = 0;
+  static const int kDegrees[] = {3, 5, 7, 9};
+  static const double *kCoeffs[] = {kPade3, kPade5, kPade7, kPade9};
+  for (int i = 0; i < 4 && degree == 13; ++i) {
+    if (norm <= kTheta[i]) {
+      degree = kDegrees[i];
+      coeffs = kCoeffs[i];
+    }
+  }
+  if (degree == 13 && norm > kTheta[4]) {
+    squarings = (int)std::ceil(std::log2(norm / kTheta[4]));
+    double scale = std::ldexp(1.0, -squarings);
+    for (int i = 0; i < total; ++i) a[i] *= scale;
+  }
+
+  // v collects the even terms, u the odd ones before the final product by a.
+  multiply_into(a2, a.data(), a.data(), spare, size);
+  set_identity(v, size, coeffs[0]);
+  set_identity(u, size, coeffs[1]);
+  if (degree == 13) {
+    multiply_into(a4, a2.data(), a2.data(), spare, size);
+    multiply_into(a6, a4.data(), a2.data(), spare, size);
+    for (int i = 0; i < total; ++i) {
+      spare[i] = coeffs[13] * a6[i] + coeffs[11] * a4[i] + coeffs[9] * a2[i];
+    }
+    kernel_gemm(a6.data(), spare.data(), u.data(), size, size, size);
+    for (int i = 0; i < total; ++i) {
+      spare[i] = coeffs[12] * a6[i] + coeffs[10] * a4[i] + coeffs[8] * a2[i];
+    }
+    kernel_gemm(a6.data(), spare.data(), v.data(), size, size, size);
+    for (int i = 0; i < total; ++i) {
+      u[i] += coeffs[7] * a6[i] + coeffs[5] * a4[i] + coeffs[3] * a2[i];
+      v[i] += coeffs[6] * a6[i] + coeffs[4] * a4[i] + coeffs[2] * a2[i];
+    }
+    for (int i = 0; i < size; ++i) {
+      u[i * size + i] += coeffs[1];
+      v[i * size + i] += coeffs[0];
+    }
+  } else {
+    // a4 holds the running even power a^(2j)
+    a4 = a2;
+    for (int j = 1; 2 * j <= degree; ++j) {
+      if (j > 1) multiply_into(a4, a4.data(), a2.data(), spare, size);
+      for (int i = 0; i < total; ++i) {
+        v[i] += coeffs[2 * j] * a4[i];
+        u[i] += coeffs[2 * j + 1] * a4[i];
+      }
+    }
+  }
+  multiply_into(u, a.data(), u.data(), spare, size);
+
+  // r = (v - u)^-1 (v + u), reusing a and a2 for the two sides
+  for (int i = 0; i < total; ++i) {
+    a[i] = v[i] - u[i];
+    a2[i] = v[i] + u[i];
+  }
+  solve_in_place(a, a2, size);
+  for (int i = 0; i < squarings; ++i) {
+    multiply_into(a2, a2.data(), a2.data(), spare, size);
+  }
+
+  S21Matrix exp_matrix(size, size);
+  std::memcpy(exp_matrix.matrix_, a2.data(), total * sizeof(double));
+  return exp_matrix;
+}
+
+// Paterson-Stockmeyer: with s ~ sqrt(degree) the polynomial is split into
+// blocks of s coefficients, each block is a combination of the cached powers
+// I, A, ..., A^(s-1), and the blocks are combined by Horner's rule in A^s.
+// s == 1 reduces to plain Horner.
+S21Matrix S21Matrix::Polynomial(const std::vector<double> &coefficients) const {
+  if (rows_ != cols_) throw NonSquareMatrixException();
+
+  const int size = rows_;
+  const int total = size * size;
+  const int degree = (int)coefficients.size() - 1;
+  S21Matrix poly_matrix(size, size);
+  if (degree < 0) return poly_matrix;
+
+  int step = (int)std::sqrt((double)degree);
+  if (step < 1) step = 1;
+  // powers[i] = A^(i + 1), powers[step - 1] = A^step
+  std::vector<std::vector<double>> powers(step);
+  std::vector<double> spare(total), result(total, 0.0);
+  powers[0].assign(matrix_, matrix_ + total);
+  for (int i = 1; i < step; ++i) {
+    powers[i].resize(total);
+    kernel_gemm(powers[i - 1].data(), matrix_, powers[i].data(), size, size,
+                size);
+  }
+
+  const int blocks = degree / step + 1;
+  for (int block = blocks - 1; block >= 0; --block) {
+    if (block != blocks - 1) {
+      multiply_into(result, result.data(), powers[step - 1].data(), spare,
+                    size);
+    }
+    for (int i = 0; i < step; ++i) {
+      int index = block * step + i;
+      if (index > degree) break;
+      if (i == 0) {
+        for (int d = 0; d < size; ++d) {
+          result[d * size + d] += coefficients[index];
+        }
+      } else {
+        const double *power = powers[i - 1].data();
+        for (int k = 0; k < total; ++k) {
+          result[k] += coefficients[index] * power[k];
+        }
+      }
+    }
+  }
+
+  std::memcpy(poly_matrix.matrix_, result.data(), total * sizeof(double));
+  return poly_matrix;
+}
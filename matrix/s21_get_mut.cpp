@@ -1,9 +1,10 @@
 #include "s21_exceptions.h"
+#include "s21_kernels.h"
 #include "s21_matrix_oop.h"
 
-int S21Matrix::get_matrix_rows() const { return this->rows_; }
+int S21Matrix::get_matrix_rows() const noexcept { return this->rows_; }
 
-int S21Matrix::get_matrix_cols() const { return this->cols_; }
+int S21Matrix::get_matrix_cols() const noexcept { return this->cols_; }
 
 double S21Matrix::get_matrix_element(int row, int col) const {
   if (row < 1 || col < 1 || row > this->rows_ || col > this->cols_) {
@@ -12,11 +13,30 @@ double S21Matrix::get_matrix_element(int row, int col) const {
   return this->matrix_[(this->cols_ * (row - 1)) + col - 1];
 }
 
+std::uint64_t S21Matrix::get_content_hash() const noexcept {
+  // Racing threads compute the same value, so relaxed ordering suffices.
+  std::uint64_t hash = hash_.load(std::memory_order_relaxed);
+  if (hash == HASH_UNSET) {
+    std::uint64_t shape = ((std::uint64_t)rows_ << 32) | (std::uint32_t)cols_;
+    hash = kernel_hash(matrix_, rows_ * cols_, shape);
+    if (hash == HASH_UNSET) hash = HASH_UNSET + 1;
+    hash_.store(hash, std::memory_order_relaxed);
+  }
+  return hash;
+}
+
+bool S21Matrix::IsBitwiseEqual(const S21Matrix &other) const noexcept {
+  return rows_ == other.rows_ && cols_ == other.cols_ &&
+         std::memcmp(matrix_, other.matrix_,
+                     rows_ * cols_ * sizeof(double)) == 0;
+}
+
 void S21Matrix::mutate_matrix_element(int row, int col, double val) {
   if (row < 1 || col < 1 || row > this->rows_ || col > this->cols_) {
     throw IndexOutOfBoundsException();
   }
 
+  this->hash_ = HASH_UNSET;
   this->matrix_[(this->cols_ * (row - 1)) + col - 1] = val;
 }
 
@@ -29,7 +49,7 @@ void S21Matrix::mutate_number_of_cols(int new_cols) {
     for (int col = 0; col < new_cols; col++) {
       if (col < this->cols_) {
         new_matrix[row * new_cols + col] =
-            this->get_matrix_element(row + 1, col + 1);
+            this->matrix_[row * this->cols_ + col];
       } else {
         new_matrix[row * new_cols + col] = 0.0;  // Fill with 0 for new columns
       }
@@ -38,6 +58,7 @@ void S21Matrix::mutate_number_of_cols(int new_cols) {
   delete[] this->matrix_;
   this->matrix_ = new_matrix;
   this->cols_ = new_cols;
+  this->hash_ = HASH_UNSET;
 }
 
 void S21Matrix::mutate_number_of_rows(int new_rows) {
@@ -49,7 +70,7 @@ void S21Matrix::mutate_number_of_rows(int new_rows) {
     for (int col = 0; col < this->cols_; col++) {
       if (row < this->rows_) {
         new_matrix[row * this->cols_ + col] =
-            this->get_matrix_element(row + 1, col + 1);
+            this->matrix_[row * this->cols_ + col];
       } else {
         new_matrix[row * this->cols_ + col] = 0.0;  // Fill with 0 for new rows
       }
@@ -58,4 +79,5 @@ void S21Matrix::mutate_number_of_rows(int new_rows) {
   delete[] this->matrix_;
   this->matrix_ = new_matrix;
   this->rows_ = new_rows;
+  this->hash_ = HASH_UNSET;
 }
@@ -0,0 +1,172 @@
+#include <algorithm>
+#include <cstring>
+
+#include "s21_kernels.h"
+
+#define GEMM_BLOCK_SIZE 64
+#define PAIRWISE_BLOCK_SIZE 128
+#define AXPY_BLOCK_SIZE 16
+
+// The vector kernels are compiled once per x86-64 ISA level and the dynamic
+// loader binds the best clone for the running CPU through an ifunc resolver
+// (CPUID), so one binary uses AVX2/AVX-512 where available. Clones calling
+// clones of the same level skip the resolver. ThreadSanitizer builds keep a
+// single version: the resolvers run before its runtime is initialized.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && \
+    defined(__linux__) && !defined(__SANITIZE_THREAD__)
+#define KERNEL_CLONES                                                   \
+  __attribute__((target_clones("default", "arch=x86-64-v2",             \
+                               "arch=x86-64-v3", "arch=x86-64-v4")))
+#else
+#define KERNEL_CLONES
+#endif
+
+// Fixed-size inner blocks on non-aliasing pointers: GCC's -O2 cost model
+// vectorizes a loop only when it needs neither an alias check nor a scalar
+// epilogue, so the open-ended loop stayed scalar outside -O3.
+template <typename T>
+KERNEL_CLONES
+static void axpy_impl(T alpha, const T* __restrict__ x, T* __restrict__ y,
+                      int size) {
+  int i = 0;
+  for (; i + AXPY_BLOCK_SIZE <= size; i += AXPY_BLOCK_SIZE) {
+    for (int lane = 0; lane < AXPY_BLOCK_SIZE; ++lane) {
+      y[i + lane] += alpha * x[i + lane];
+    }
+  }
+  for (; i < size; ++i) {
+    y[i] += alpha * x[i];
+  }
+}
+
+// Pairwise summation of term(begin) .. term(end - 1): the range is halved
+// down to blocks of PAIRWISE_BLOCK_SIZE, so the rounding error grows with
+// log(size) instead of size. Inside a block four independent partial sums
+// break the dependency chain of the accumulator, which lets the loop
+// vectorize without -ffast-math.
+template <typename T, typename Term>
+KERNEL_CLONES
+static T pairwise_sum(const Term& term, int begin, int end) {
+  if (end - begin > PAIRWISE_BLOCK_SIZE) {
+    int middle = begin + (end - begin) / 2;
+    return pairwise_sum<T>(term, begin, middle) +
+           pairwise_sum<T>(term, middle, end);
+  }
+  T acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+  int i = begin;
+  for (; i + 4 <= end; i += 4) {
+    acc0 += term(i);
+    acc1 += term(i + 1);
+    acc2 += term(i + 2);
+    acc3 += term(i + 3);
+  }
+  for (; i < end; ++i) {
+    acc0 += term(i);
+  }
+  return (acc0 + acc1) + (acc2 + acc3);
+}
+
+template <typename T>
+KERNEL_CLONES
+static T dot_impl(const T* x, const T* y, int size) {
+  return pairwise_sum<T>([x, y](int i) { return x[i] * y[i]; }, 0, size);
+}
+
+KERNEL_CLONES
+void kernel_axpy(float alpha, const float* x, float* y, int size) {
+  axpy_impl(alpha, x, y, size);
+}
+
+KERNEL_CLONES
+void kernel_axpy(double alpha, const double* x, double* y, int size) {
+  axpy_impl(alpha, x, y, size);
+}
+
+KERNEL_CLONES
+float kernel_dot(const float* x, const float* y, int size) {
+  return dot_impl(x, y, size);
+}
+
+KERNEL_CLONES
+double kernel_dot(const double* x, const double* y, int size) {
+  return dot_impl(x, y, size);
+}
+
+KERNEL_CLONES
+double kernel_sum(const double* x, int size) {
+  return pairwise_sum<double>([x](int i) { return x[i]; }, 0, size);
+}
+
+KERNEL_CLONES
+double kernel_asum(const double* x, int size) {
+  return pairwise_sum<double>([x](int i) { return std::abs(x[i]); }, 0, size);
+}
+
+KERNEL_CLONES
+double kernel_max_abs(const double* x, int size) {
+  double max0 = 0, max1 = 0, max2 = 0, max3 = 0;
+  int i = 0;
+  for (; i + 4 <= size; i += 4) {
+    max0 = max_propagate_nan(max0, std::abs(x[i]));
+    max1 = max_propagate_nan(max1, std::abs(x[i + 1]));
+    max2 = max_propagate_nan(max2, std::abs(x[i + 2]));
+    max3 = max_propagate_nan(max3, std::abs(x[i + 3]));
+  }
+  for (; i < size; ++i) {
+    max0 = max_propagate_nan(max0, std::abs(x[i]));
+  }
+  return max_propagate_nan(max_propagate_nan(max0, max1),
+                           max_propagate_nan(max2, max3));
+}
+
+// i-k-j order keeps every inner loop a contiguous axpy over a row of b. The
+// inner dimension is walked in blocks so a band of rows of b stays in cache
+// while it is reused for every row of the result.
+KERNEL_CLONES
+void kernel_gemm(const double* a, const double* b, double* result, int rows,
+                 int inner, int cols) {
+  for (int i = 0; i < rows * cols; ++i) result[i] = 0.0;
+  for (int block = 0; block < inner; block += GEMM_BLOCK_SIZE) {
+    int block_end =
+        block + GEMM_BLOCK_SIZE < inner ? block + GEMM_BLOCK_SIZE : inner;
+    for (int i = 0; i < rows; ++i) {
+      for (int k = block; k < block_end; ++k) {
+        axpy_impl(a[i * inner + k], b + k * cols, result + i * cols, cols);
+      }
+    }
+  }
+}
+
+// Four independent multiply-xorshift lanes, folded together and finalized
+// with the murmur3 mixer at the end.
+std::uint64_t kernel_hash(const double* data, int size, std::uint64_t seed) {
+  const std::uint64_t kMul = 0x9E3779B97F4A7C15ULL;
+  std::uint64_t lanes[4] = {seed, seed + kMul, seed + 2 * kMul,
+                            seed + 3 * kMul};
+  int i = 0;
+  for (; i + 4 <= size; i += 4) {
+    for (int lane = 0; lane < 4; ++lane) {
+      std::uint64_t word;
+      std::memcpy(&word, data + i + lane, sizeof(word));
+      lanes[lane] = (lanes[lane] ^ word) * kMul;
+      lanes[lane] ^= lanes[lane] >> 29;
+    }
+  }
+  for (; i < size; ++i) {
+    std::uint64_t word;
+    std::memcpy(&word, data + i, sizeof(word));
+    lanes[0] = (lanes[0] ^ word) * kMul;
+    lanes[0] ^= lanes[0] >> 29;
+  }
+  std::uint64_t hash = (std::uint64_t)size;
+  for (int lane = 0; lane < 4; ++lane) {
+    hash = (hash ^ lanes[lane]) * kMul;
+    hash ^= hash >> 32;
+  }
+  hash ^= hash >> 33;
+  hash *= 0xFF51AFD7ED558CCDULL;
+  hash ^= hash >> 33;
+  hash *= 0xC4CEB9FE1A85EC53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
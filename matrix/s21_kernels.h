@@ -0,0 +1,118 @@
+#ifndef S21_KERNELS_H
+#define S21_KERNELS_H
+
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+// Low-level kernels working on raw row-major buffers. The vector primitives
+// are written with independent accumulators so the compiler can keep them in
+// SIMD registers; everything else is built on top of them.
+
+// y += alpha * x, x and y must not overlap
+void kernel_axpy(float alpha, const float* x, float* y, int size);
+void kernel_axpy(double alpha, const double* x, double* y, int size);
+// dot and the sums below use pairwise summation
+float kernel_dot(const float* x, const float* y, int size);
+double kernel_dot(const double* x, const double* y, int size);
+double kernel_sum(const double* x, int size);
+double kernel_asum(const double* x, int size);  // sum of |x[i]|
+double kernel_max_abs(const double* x, int size);  // NaN if any x[i] is NaN
+// 64-bit content hash of the bit patterns of data, mixed with seed
+std::uint64_t kernel_hash(const double* data, int size, std::uint64_t seed);
+// result = a * b for row-major a (rows x inner) and b (inner x cols); result
+// must not alias a or b
+void kernel_gemm(const double* a, const double* b, double* result, int rows,
+                 int inner, int cols);
+
+// max that propagates NaN from either side, unlike std::max which drops a
+// NaN in its second argument
+inline double max_propagate_nan(double acc, double value) {
+  return (value > acc || value != value) ? value : acc;
+}
+
+#define LU_BLOCK_SIZE 64
+
+// In-place LU decomposition with partial pivoting, PA = LU. The unit lower
+// triangle L and the upper triangle U overwrite the matrix, pivots[k] is the
+// row swapped with row k on step k. Returns false on a zero or non-finite
+// pivot, the buffer is left partially factorized in that case.
+//
+// Right-looking blocked variant: a panel of LU_BLOCK_SIZE columns is factored
+// first, then the trailing matrix is updated with the whole panel so each row
+// of U12 is reused from cache for every row below it.
+template <typename T>
+bool lu_decompose(T* matrix, int size, int* pivots) {
+  for (int block = 0; block < size; block += LU_BLOCK_SIZE) {
+    const int block_end =
+        block + LU_BLOCK_SIZE < size ? block + LU_BLOCK_SIZE : size;
+    const int tail = size - block_end;
+
+    for (int k = block; k < block_end; ++k) {
+      int max_row = k;
+      T max_val = std::abs(matrix[k * size + k]);
+      for (int i = k + 1; i < size; ++i) {
+        T val = std::abs(matrix[i * size + k]);
+        if (val > max_val) {
+          max_val = val;
+          max_row = i;
+        }
+      }
+      pivots[k] = max_row;
+      if (max_val == T(0) || !std::isfinite(max_val)) return false;
+      if (max_row != k) {
+        for (int col = 0; col < size; ++col) {
+          std::swap(matrix[k * size + col], matrix[max_row * size + col]);
+        }
+      }
+      const T* pivot_row = matrix + k * size;
+      for (int i = k + 1; i < size; ++i) {
+        T* row = matrix + i * size;
+        row[k] /= pivot_row[k];
+        kernel_axpy(-row[k], pivot_row + k + 1, row + k + 1,
+                    block_end - k - 1);
+      }
+    }
+
+    if (tail == 0) break;
+    // U12 = L11^-1 * A12
+    for (int k = block; k < block_end; ++k) {
+      for (int i = k + 1; i < block_end; ++i) {
+        kernel_axpy(-matrix[i * size + k], matrix + k * size + block_end,
+                    matrix + i * size + block_end, tail);
+      }
+    }
+    // A22 -= L21 * U12
+    for (int i = block_end; i < size; ++i) {
+      T* row = matrix + i * size;
+      for (int k = block; k < block_end; ++k) {
+        kernel_axpy(-row[k], matrix + k * size + block_end, row + block_end,
+                    tail);
+      }
+    }
+  }
+  return true;
+}
+
+// Solves A X = B using factors produced by lu_decompose. The right-hand side
+// is stored column-major (each of the rhs_cols columns is contiguous) and is
+// overwritten by the solution.
+template <typename T>
+void lu_solve(const T* lu, int size, const int* pivots, T* rhs,
+              int rhs_cols) {
+  for (int col = 0; col < rhs_cols; ++col) {
+    T* x = rhs + col * size;
+    for (int k = 0; k < size; ++k) {
+      if (pivots[k] != k) std::swap(x[k], x[pivots[k]]);
+    }
+    for (int i = 1; i < size; ++i) {
+      x[i] -= kernel_dot(lu + i * size, x, i);
+    }
+    for (int i = size - 1; i >= 0; --i) {
+      const T* row = lu + i * size;
+      x[i] = (x[i] - kernel_dot(row + i + 1, x + i + 1, size - i - 1)) / row[i];
+    }
+  }
+}
+
+#endif
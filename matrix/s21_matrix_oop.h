@@ -1,21 +1,72 @@
 #ifndef __S21_MATRIX_OOP_H__
 #define __S21_MATRIX_OOP_H__
 
+#include <atomic>
+#include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <vector>
+
+#include "s21_result.h"
 
 #define EPS_DET 1e-100
+// hash_ value meaning "not computed yet"
+#define HASH_UNSET 0
+
+// det = sign * exp(log_abs); sign is 0 and log_abs is -inf for singular input,
+// both are NaN if the input holds a NaN or an infinity
+struct S21LogDeterminant {
+  double sign;
+  double log_abs;
+};
+
+class S21DiagonalMatrix;
+class S21BandedMatrix;
+class S21TriangularMatrix;
+class S21SymmetricMatrix;
 
 class S21Matrix {
  private:
   double* matrix_;
   int rows_;
   int cols_;
+  // content hash memoized for S21MatrixCache, every write to matrix_ or to the
+  // shape must reset it to HASH_UNSET. Atomic because const matrices may be
+  // hashed from several threads at once, e.g. concurrent cache lookups.
+  mutable std::atomic<std::uint64_t> hash_;
+
+  // uncached implementations behind the S21MatrixCache lookups
+  double ComputeDeterminant() const;
+  S21Matrix ComputeComplements() const;
+  // writes into a preallocated square inverse, a singular or 1x1 matrix is
+  // reported as kDeterminantZero or kIndexOutOfBounds instead of thrown
+  S21Status ComputeInverse(S21Matrix& inverse) const;
+  // cached ComputeInverse shared by InverseMatrix and TryInverseMatrix
+  S21Status InverseInto(S21Matrix& inverse);
+  // SolveRefined without the shape checks, false if the matrix is singular
+  bool SolveRefinedInto(const S21Matrix& rhs, S21Matrix& solution) const;
+
+  // structured matrix kernels work on the dense buffer directly
+  friend class S21DiagonalMatrix;
+  friend class S21BandedMatrix;
+  friend class S21TriangularMatrix;
+  friend class S21SymmetricMatrix;
+  friend S21Matrix operator*(const S21Matrix& lhs,
+                             const S21DiagonalMatrix& rhs);
+  friend S21Matrix operator*(const S21Matrix& lhs, const S21BandedMatrix& rhs);
+  friend S21Matrix operator*(const S21Matrix& lhs,
+                             const S21TriangularMatrix& rhs);
+  friend S21Matrix operator*(const S21Matrix& lhs,
+                             const S21SymmetricMatrix& rhs);
 
  public:
-  int get_matrix_rows() const;
-  int get_matrix_cols() const;
+  int get_matrix_rows() const noexcept;
+  int get_matrix_cols() const noexcept;
   double get_matrix_element(int row, int col) const;
+  std::uint64_t get_content_hash() const noexcept;  // hash of shape and data
+  // same shape and bit patterns, the equality get_content_hash is built on:
+  // NaN matches NaN, 0.0 does not match -0.0
+  bool IsBitwiseEqual(const S21Matrix& other) const noexcept;
 
   void mutate_number_of_cols(int cols);
   void mutate_number_of_rows(int rows);
@@ -24,31 +75,73 @@ class S21Matrix {
   S21Matrix();                        // default constructor
   S21Matrix(int rows, int cols);      // parameterized constructor
   S21Matrix(const S21Matrix& other);  // copy constructor
-  S21Matrix(S21Matrix&& other);       // move constructor
-  ~S21Matrix();                       // destructor
+  S21Matrix(S21Matrix&& other) noexcept;  // move constructor
+  ~S21Matrix() noexcept;                  // destructor
 
   // some operators overloads
   S21Matrix operator+(const S21Matrix& other);
   S21Matrix operator-(const S21Matrix& other);
   S21Matrix operator*(const S21Matrix& other);
   S21Matrix operator*(const double number);
-  bool operator==(const S21Matrix& other);
+  bool operator==(const S21Matrix& other) noexcept;
   void operator=(const S21Matrix& other);
+  void operator=(S21Matrix&& other) noexcept;
   void operator+=(const S21Matrix& other);
   void operator-=(const S21Matrix& other);
   void operator*=(const S21Matrix& other);
-  void operator*=(const double number);
+  void operator*=(const double number) noexcept;
   double operator()(int i, int j);
   // some public methods
-  bool EqMatrix(const S21Matrix& other);
+  bool EqMatrix(const S21Matrix& other) noexcept;
   void SumMatrix(const S21Matrix& other);
   void SubMatrix(const S21Matrix& other);
-  void MulNumber(const double num);
+  void MulNumber(const double num) noexcept;
   void MulMatrix(const S21Matrix& other);
   S21Matrix Transpose();
   S21Matrix CalcComplements();
   double Determinant();
+  // overwrite == true factorizes in place: the matrix then holds its LU factors
+  S21LogDeterminant LogDeterminant(bool overwrite = false);
   S21Matrix InverseMatrix();
+  // solves this * X = rhs: float LU plus double-precision refinement; X is
+  // all NaN if this holds a NaN or an infinity
+  S21Matrix SolveRefined(const S21Matrix& rhs) const;
+  // negative powers go through the inverse
+  S21Matrix Power(int power) const;
+  // all NaN if an element is infinite or NaN
+  S21Matrix Exp() const;
+  // coefficients[i] multiplies A^i
+  S21Matrix Polynomial(const std::vector<double>& coefficients) const;
+  // reductions, multithreaded for large matrices
+  double Trace() const;
+  double FrobeniusNorm() const;
+  double OneNorm() const;  // max column sum of |a_ij|
+  double InfNorm() const;  // max row sum of |a_ij|
+  double MaxAbs() const;
+  S21Matrix RowSums() const;  // rows x 1
+  S21Matrix ColSums() const;  // 1 x cols
+  double Dot(const S21Matrix& other) const;  // sum of a_ij * b_ij
+  // |this - other| <= atol + rtol * |other| element-wise, stops at the first
+  // mismatch
+  bool ApproxEqual(const S21Matrix& other, double rtol = 1e-5,
+                   double atol = 1e-8) const;
+
+  // Exception-free counterparts of the calls above: the shape checks report
+  // an S21Status instead of throwing, allocation failure is kOutOfMemory.
+  static S21Result<S21Matrix> TryCreate(int rows, int cols) noexcept;
+  S21Result<double> try_get_matrix_element(int row, int col) const noexcept;
+  S21Status try_mutate_matrix_element(int row, int col, double val) noexcept;
+  S21Status try_mutate_number_of_rows(int rows) noexcept;
+  S21Status try_mutate_number_of_cols(int cols) noexcept;
+  S21Status TrySumMatrix(const S21Matrix& other) noexcept;
+  S21Status TrySubMatrix(const S21Matrix& other) noexcept;
+  S21Status TryMulMatrix(const S21Matrix& other) noexcept;
+  S21Result<double> TryDeterminant() noexcept;
+  S21Result<S21LogDeterminant> TryLogDeterminant(
+      bool overwrite = false) noexcept;
+  S21Result<S21Matrix> TryCalcComplements() noexcept;
+  S21Result<S21Matrix> TryInverseMatrix() noexcept;
+  S21Result<S21Matrix> TrySolveRefined(const S21Matrix& rhs) const noexcept;
 };
 double calculate_matrix_mul_element(const S21Matrix& matrix1,
                                     const S21Matrix& matrix2, int row, int col);
@@ -1,12 +1,18 @@
+#include <limits>
+#include <vector>
+
+#include "s21_cache.h"
 #include "s21_exceptions.h"
+#include "s21_kernels.h"
 #include "s21_matrix_oop.h"
 
-bool S21Matrix::EqMatrix(const S21Matrix &other) {
+bool S21Matrix::EqMatrix(const S21Matrix &other) noexcept {
   bool status = true;
   if (this->rows_ != other.rows_ || this->cols_ != other.cols_)
     status = false;
   else {
-    for (int element = 0; element < this->rows_ * this->cols_; element++) {
+    for (int element = 0; element < this->rows_ * this->cols_ && status;
+         element++) {
       if (this->matrix_[element] != other.matrix_[element]) status = false;
     }
   }
@@ -17,6 +23,7 @@ void S21Matrix::SumMatrix(const S21Matrix &other) {
   if (this->rows_ != other.rows_ || this->cols_ != other.cols_) {
     throw DimensionMismatchException();
   }
+  this->hash_ = HASH_UNSET;
   for (int element = 0; element < this->rows_ * this->cols_; element++) {
     this->matrix_[element] = this->matrix_[element] + other.matrix_[element];
   }
@@ -26,12 +33,14 @@ void S21Matrix::SubMatrix(const S21Matrix &other) {
   if (this->rows_ != other.rows_ || this->cols_ != other.cols_) {
     throw DimensionMismatchException();
   }
+  this->hash_ = HASH_UNSET;
   for (int element = 0; element < this->rows_ * this->cols_; element++) {
     this->matrix_[element] = this->matrix_[element] - other.matrix_[element];
   }
 }
 
-void S21Matrix::MulNumber(const double num) {
+void S21Matrix::MulNumber(const double num) noexcept {
+  this->hash_ = HASH_UNSET;
   for (int element = 0; element < this->rows_ * this->cols_; element++) {
     this->matrix_[element] = this->matrix_[element] * num;
   }
@@ -42,15 +51,12 @@ void S21Matrix::MulMatrix(const S21Matrix &other) {
     throw ColumnRowMismatchException();
   }
   double *mul_result_matrix = new double[this->rows_ * other.cols_];
-  for (int row = 1; row <= this->rows_; row++) {
-    for (int col = 1; col <= other.cols_; col++) {
-      mul_result_matrix[other.cols_ * (row - 1) + col - 1] =
-          calculate_matrix_mul_element(*this, other, row, col);
-    }
-  }
+  kernel_gemm(this->matrix_, other.matrix_, mul_result_matrix, this->rows_,
+              this->cols_, other.cols_);
   delete[] this->matrix_;
   this->matrix_ = mul_result_matrix;
   this->cols_ = other.cols_;
+  this->hash_ = HASH_UNSET;
 }
 
 double calculate_matrix_mul_element(const S21Matrix &matrix1,
@@ -69,13 +75,24 @@ S21Matrix S21Matrix::Transpose() {
   for (int row = 1; row <= this->rows_; row++) {
     for (int col = 1; col <= this->cols_; col++) {
       result_matrix.matrix_[this->rows_ * (col - 1) + row - 1] =
-          this->get_matrix_element(row, col);
+          this->matrix_[this->cols_ * (row - 1) + col - 1];
     }
   }
   return result_matrix;
 }
 
 S21Matrix S21Matrix::CalcComplements() {
+  S21MatrixCache &cache = S21MatrixCache::Instance();
+  if (!cache.IsEnabled()) return ComputeComplements();
+  S21Matrix complements(1, 1);
+  if (!cache.Lookup(S21CachedOperation::kComplements, *this, complements)) {
+    complements = ComputeComplements();
+    cache.Insert(S21CachedOperation::kComplements, *this, complements);
+  }
+  return complements;
+}
+
+S21Matrix S21Matrix::ComputeComplements() const {
   if (rows_ != cols_) throw NonSquareMatrixException();
 
   S21Matrix complements(rows_, cols_);
@@ -95,7 +112,7 @@ S21Matrix S21Matrix::CalcComplements() {
         ++sub_i;
         sub_j = 0;
       }
-      double det = submatrix.Determinant();
+      double det = submatrix.ComputeDeterminant();
       double sign = ((i + j) % 2 == 0) ? 1.0 : -1.0;
       complements.matrix_[i * cols_ + j] = sign * det;
     }
@@ -105,6 +122,17 @@ S21Matrix S21Matrix::CalcComplements() {
 }
 
 double S21Matrix::Determinant() {
+  S21MatrixCache &cache = S21MatrixCache::Instance();
+  if (!cache.IsEnabled()) return ComputeDeterminant();
+  S21Matrix det(1, 1);
+  if (!cache.Lookup(S21CachedOperation::kDeterminant, *this, det)) {
+    det.matrix_[0] = ComputeDeterminant();
+    cache.Insert(S21CachedOperation::kDeterminant, *this, det);
+  }
+  return det.matrix_[0];
+}
+
+double S21Matrix::ComputeDeterminant() const {
   if (rows_ != cols_) throw NonSquareMatrixException();
 
   if (rows_ == 1) {
@@ -145,20 +173,77 @@ double S21Matrix::Determinant() {
   }
 }
 
+S21LogDeterminant S21Matrix::LogDeterminant(bool overwrite) {
+  if (rows_ != cols_) throw NonSquareMatrixException();
+
+  std::vector<double> copy;
+  double *lu = matrix_;
+  if (!overwrite) {
+    copy.assign(matrix_, matrix_ + rows_ * cols_);
+    lu = copy.data();
+  }
+  std::vector<int> pivots(rows_);
+  if (overwrite) hash_ = HASH_UNSET;
+  if (!lu_decompose(lu, rows_, pivots.data())) {
+    // a NaN or infinite input reaches a pivot or survives in the buffer,
+    // and must not pass for an exactly singular matrix
+    if (!std::isfinite(kernel_max_abs(lu, rows_ * cols_))) {
+      const double nan = std::numeric_limits<double>::quiet_NaN();
+      return {nan, nan};
+    }
+    return {0.0, -std::numeric_limits<double>::infinity()};
+  }
+
+  S21LogDeterminant result{1.0, 0.0};
+  for (int i = 0; i < rows_; ++i) {
+    double pivot = lu[i * cols_ + i];
+    if (pivots[i] != i) result.sign = -result.sign;
+    if (pivot < 0) result.sign = -result.sign;
+    result.log_abs += std::log(std::abs(pivot));
+  }
+  return result;
+}
+
 S21Matrix S21Matrix::InverseMatrix() {
-  double det = this->Determinant();
+  if (rows_ != cols_) throw NonSquareMatrixException();
+  S21Matrix inverse(rows_, cols_);
+  S21Status status = InverseInto(inverse);
+  if (status == S21Status::kDeterminantZero) throw DeterminantZeroException();
+  if (status == S21Status::kIndexOutOfBounds) {
+    throw IndexOutOfBoundsException();
+  }
+  return inverse;
+}
 
-  if (abs(det) < EPS_DET) throw DeterminantZeroException();
+S21Status S21Matrix::InverseInto(S21Matrix &inverse) {
+  S21MatrixCache &cache = S21MatrixCache::Instance();
+  if (!cache.IsEnabled()) return ComputeInverse(inverse);
+  if (cache.Lookup(S21CachedOperation::kInverse, *this, inverse)) {
+    return S21Status::kOk;
+  }
+  S21Status status = ComputeInverse(inverse);
+  if (status == S21Status::kOk) {
+    cache.Insert(S21CachedOperation::kInverse, *this, inverse);
+  }
+  return status;
+}
 
-  S21Matrix complements = this->CalcComplements();
+S21Status S21Matrix::ComputeInverse(S21Matrix &inverse) const {
+  double det = this->ComputeDeterminant();
+
+  if (abs(det) < EPS_DET) return S21Status::kDeterminantZero;
+  // a 1x1 matrix has no minors, ComputeComplements would reject it
+  if (rows_ == 1) return S21Status::kIndexOutOfBounds;
+
+  S21Matrix complements = this->ComputeComplements();
   S21Matrix adjugate = complements.Transpose();
 
-  S21Matrix inverse(rows_, cols_);
   for (int i = 0; i < rows_; ++i) {
     for (int j = 0; j < cols_; ++j) {
       inverse.matrix_[i * cols_ + j] = adjugate.matrix_[i * cols_ + j] / det;
     }
   }
+  inverse.hash_ = HASH_UNSET;
 
-  return inverse;
+  return S21Status::kOk;
 }
@@ -25,7 +25,9 @@ S21Matrix S21Matrix::operator*(double scalar) {
   return result;
 }
 
-bool S21Matrix::operator==(const S21Matrix& other) { return EqMatrix(other); }
+bool S21Matrix::operator==(const S21Matrix& other) noexcept {
+  return EqMatrix(other);
+}
 
 void S21Matrix::operator=(const S21Matrix& other) {
   this->~S21Matrix();
@@ -35,13 +37,27 @@ void S21Matrix::operator=(const S21Matrix& other) {
   std::memcpy(matrix_, other.matrix_, rows_ * cols_ * sizeof(double));
 }
 
+void S21Matrix::operator=(S21Matrix&& other) noexcept {
+  if (this == &other) return;
+  delete[] matrix_;
+  matrix_ = other.matrix_;
+  rows_ = other.rows_;
+  cols_ = other.cols_;
+  hash_ = HASH_UNSET;
+  other.matrix_ = nullptr;
+  other.rows_ = 0;
+  other.cols_ = 0;
+}
+
 void S21Matrix::operator+=(const S21Matrix& other) { this->SumMatrix(other); }
 
 void S21Matrix::operator-=(const S21Matrix& other) { this->SubMatrix(other); }
 
 void S21Matrix::operator*=(const S21Matrix& other) { this->MulMatrix(other); }
 
-void S21Matrix::operator*=(const double number) { this->MulNumber(number); }
+void S21Matrix::operator*=(const double number) noexcept {
+  this->MulNumber(number);
+}
 
 double S21Matrix::operator()(int i, int j) {
   return this->get_matrix_element(i, j);
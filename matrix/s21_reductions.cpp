@@ -0,0 +1,205 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "s21_exceptions.h"
+#include "s21_kernels.h"
+#include "s21_matrix_oop.h"
+
+// Below this many elements the reductions stay on the calling thread.
+#define REDUCE_PARALLEL_THRESHOLD (1 << 18)
+#define REDUCE_MAX_THREADS 8
+// ApproxEqual checks for a mismatch once per block.
+#define COMPARE_BLOCK_SIZE 256
+
+static int reduce_threads(int elements, int parts) {
+  if (elements < REDUCE_PARALLEL_THRESHOLD) return 1;
+  int threads = (int)std::thread::hardware_concurrency();
+  threads = std::min(threads, REDUCE_MAX_THREADS);
+  threads = std::min(threads, elements / (REDUCE_PARALLEL_THRESHOLD / 4));
+  threads = std::min(threads, parts);
+  return std::max(threads, 1);
+}
+
+// Largest element, NaN if any element is NaN: a diverged residual must not
+// pass a norm < tolerance check.
+static double max_of(const std::vector<double> &values) {
+  double max = 0.0;
+  for (double value : values) max = max_propagate_nan(max, value);
+  return max;
+}
+
+// Splits [0, count) into `threads` contiguous chunks and calls
+// body(begin, end, chunk) for each, the first chunk on the calling thread.
+template <typename Body>
+static void parallel_for(int count, int threads, const Body &body) {
+  std::vector<std::thread> workers;
+  for (int chunk = 1; chunk < threads; ++chunk) {
+    workers.emplace_back(body, (int)((long long)count * chunk / threads),
+                         (int)((long long)count * (chunk + 1) / threads),
+                         chunk);
+  }
+  body(0, (int)((long long)count / threads), 0);
+  for (auto &worker : workers) worker.join();
+}
+
+// Column sums of |a| (absolute) or a over all rows, Kahan-compensated per
+// column so every row update stays a contiguous, vectorizable loop.
+static std::vector<double> column_sums(const double *matrix, int rows,
+                                       int cols, bool absolute) {
+  const int threads = reduce_threads(rows * cols, rows);
+  std::vector<std::vector<double>> partial(threads,
+                                           std::vector<double>(cols, 0.0));
+  parallel_for(rows, threads, [&](int begin, int end, int chunk) {
+    double *sum = partial[chunk].data();
+    std::vector<double> compensation(cols, 0.0);
+    for (int row = begin; row < end; ++row) {
+      const double *values = matrix + (long long)row * cols;
+      for (int col = 0; col < cols; ++col) {
+        double value = absolute ? std::abs(values[col]) : values[col];
+        double term = value - compensation[col];
+        double total = sum[col] + term;
+        compensation[col] = (total - sum[col]) - term;
+        sum[col] = total;
+      }
+    }
+  });
+  for (int chunk = 1; chunk < threads; ++chunk) {
+    for (int col = 0; col < cols; ++col) {
+      partial[0][col] += partial[chunk][col];
+    }
+  }
+  return partial[0];
+}
+
+double S21Matrix::Trace() const {
+  if (rows_ != cols_) throw NonSquareMatrixException();
+  double sum = 0.0, compensation = 0.0;
+  for (int i = 0; i < rows_; ++i) {
+    double term = matrix_[i * cols_ + i] - compensation;
+    double total = sum + term;
+    compensation = (total - sum) - term;
+    sum = total;
+  }
+  return sum;
+}
+
+double S21Matrix::MaxAbs() const {
+  const int total = rows_ * cols_;
+  const int threads = reduce_threads(total, total);
+  std::vector<double> partial(threads, 0.0);
+  parallel_for(total, threads, [&](int begin, int end, int chunk) {
+    partial[chunk] = kernel_max_abs(matrix_ + begin, end - begin);
+  });
+  return max_of(partial);
+}
+
+double S21Matrix::FrobeniusNorm() const {
+  const int total = rows_ * cols_;
+  // Squares of elements outside this range would overflow or lose all
+  // precision, such matrices are scaled by their largest element first.
+  const double max_abs = MaxAbs();
+  if (max_abs == 0.0 || !std::isfinite(max_abs)) return max_abs;
+  const bool scaled = max_abs > 1e150 || max_abs < 1e-150;
+  const double scale = scaled ? max_abs : 1.0;
+
+  const int threads = reduce_threads(total, total);
+  std::vector<double> partial(threads, 0.0);
+  parallel_for(total, threads, [&](int begin, int end, int chunk) {
+    if (!scaled) {
+      partial[chunk] =
+          kernel_dot(matrix_ + begin, matrix_ + begin, end - begin);
+      return;
+    }
+    double sum = 0.0, compensation = 0.0;
+    for (int i = begin; i < end; ++i) {
+      double value = matrix_[i] / scale;
+      double term = value * value - compensation;
+      double next = sum + term;
+      compensation = (next - sum) - term;
+      sum = next;
+    }
+    partial[chunk] = sum;
+  });
+  double sum = 0.0;
+  for (double value : partial) sum += value;
+  return scale * std::sqrt(sum);
+}
+
+double S21Matrix::OneNorm() const {
+  return max_of(column_sums(matrix_, rows_, cols_, true));
+}
+
+double S21Matrix::InfNorm() const {
+  const int threads = reduce_threads(rows_ * cols_, rows_);
+  std::vector<double> partial(threads, 0.0);
+  parallel_for(rows_, threads, [&](int begin, int end, int chunk) {
+    for (int row = begin; row < end; ++row) {
+      double row_sum = kernel_asum(matrix_ + row * cols_, cols_);
+      partial[chunk] = max_propagate_nan(partial[chunk], row_sum);
+    }
+  });
+  return max_of(partial);
+}
+
+S21Matrix S21Matrix::RowSums() const {
+  S21Matrix sums(rows_, 1);
+  const int threads = reduce_threads(rows_ * cols_, rows_);
+  parallel_for(rows_, threads, [&](int begin, int end, int) {
+    for (int row = begin; row < end; ++row) {
+      sums.matrix_[row] = kernel_sum(matrix_ + row * cols_, cols_);
+    }
+  });
+  return sums;
+}
+
+S21Matrix S21Matrix::ColSums() const {
+  std::vector<double> sums = column_sums(matrix_, rows_, cols_, false);
+  S21Matrix result(1, cols_);
+  std::copy(sums.begin(), sums.end(), result.matrix_);
+  return result;
+}
+
+double S21Matrix::Dot(const S21Matrix &other) const {
+  if (rows_ != other.rows_ || cols_ != other.cols_) {
+    throw DimensionMismatchException();
+  }
+  const int total = rows_ * cols_;
+  const int threads = reduce_threads(total, total);
+  std::vector<double> partial(threads, 0.0);
+  parallel_for(total, threads, [&](int begin, int end, int chunk) {
+    partial[chunk] =
+        kernel_dot(matrix_ + begin, other.matrix_ + begin, end - begin);
+  });
+  double sum = 0.0;
+  for (double value : partial) sum += value;
+  return sum;
+}
+
+// |a - b| <= atol + rtol * |b| element-wise. Each block is checked without
+// branches so it vectorizes, and the scan stops at the first failing block.
+// NaN never compares equal.
+bool S21Matrix::ApproxEqual(const S21Matrix &other, double rtol,
+                            double atol) const {
+  if (rows_ != other.rows_ || cols_ != other.cols_) return false;
+  const int total = rows_ * cols_;
+  const int threads = reduce_threads(total, total);
+  std::atomic<bool> mismatch(false);
+  parallel_for(total, threads, [&](int begin, int end, int) {
+    for (int block = begin; block < end; block += COMPARE_BLOCK_SIZE) {
+      if (mismatch.load(std::memory_order_relaxed)) return;
+      const int block_end = std::min(block + COMPARE_BLOCK_SIZE, end);
+      bool failed = false;
+      for (int i = block; i < block_end; ++i) {
+        double tolerance = atol + rtol * std::abs(other.matrix_[i]);
+        failed |= !(std::abs(matrix_[i] - other.matrix_[i]) <= tolerance);
+      }
+      if (failed) {
+        mismatch.store(true, std::memory_order_relaxed);
+        return;
+      }
+    }
+  });
+  return !mismatch.load();
+}
@@ -0,0 +1,69 @@
+#ifndef S21_RESULT_H
+#define S21_RESULT_H
+
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+// Status codes of the exception-free Try* API, one per S21Exception subclass
+// plus allocation failure.
+enum class S21Status {
+  kOk,
+  kDimensionMismatch,
+  kColumnRowMismatch,
+  kNonSquare,
+  kDeterminantZero,
+  kIndexOutOfBounds,
+  kOutOfMemory
+};
+
+// Same texts as the matching exceptions, without building a std::string.
+inline const char* S21StatusMessage(S21Status status) noexcept {
+  switch (status) {
+    case S21Status::kOk:
+      return "Ok.";
+    case S21Status::kDimensionMismatch:
+      return "Error: Different matrix dimensions.";
+    case S21Status::kColumnRowMismatch:
+      return "Error: Number of columns of the first matrix is not equal to "
+             "the number of rows of the second matrix.";
+    case S21Status::kNonSquare:
+      return "Error: Matrix is not square.";
+    case S21Status::kDeterminantZero:
+      return "Error: Determinant of the matrix is zero.";
+    case S21Status::kIndexOutOfBounds:
+      return "Error: Index is out of bounds.";
+    case S21Status::kOutOfMemory:
+      return "Error: Out of memory.";
+  }
+  return "Error: Unknown status.";
+}
+
+// Either a value or the status explaining why there is none, a minimal
+// stand-in for C++23 std::expected<T, S21Status>.
+template <typename T>
+class S21Result {
+ private:
+  std::optional<T> value_;
+  S21Status status_;
+
+ public:
+  S21Result(T&& value) noexcept(std::is_nothrow_move_constructible<T>::value)
+      : value_(std::move(value)), status_(S21Status::kOk) {}
+  S21Result(const T& value) : value_(value), status_(S21Status::kOk) {}
+  S21Result(S21Status status) noexcept : status_(status) {}
+
+  bool ok() const noexcept { return status_ == S21Status::kOk; }
+  explicit operator bool() const noexcept { return ok(); }
+  S21Status status() const noexcept { return status_; }
+
+  // only valid when ok()
+  T& value() & noexcept { return *value_; }
+  const T& value() const& noexcept { return *value_; }
+  T&& value() && noexcept { return std::move(*value_); }
+  T value_or(T fallback) const& {
+    return ok() ? *value_ : std::move(fallback);
+  }
+};
+
+#endif
@@ -0,0 +1,116 @@
+#include <cfloat>
+#include <limits>
+#include <vector>
+
+#include "s21_exceptions.h"
+#include "s21_kernels.h"
+#include "s21_matrix_oop.h"
+
+#define REFINE_MAX_ITER 30
+// Refinement is abandoned when a step reduces the residual by less than this
+// factor: the float factorization is too inaccurate for the matrix.
+#define REFINE_MIN_CONTRACTION 0.5
+
+static double inf_norm(const double* values, int size) {
+  double norm = 0.0;
+  for (int i = 0; i < size; ++i) {
+    if (std::abs(values[i]) > norm) norm = std::abs(values[i]);
+  }
+  return norm;
+}
+
+static bool fits_float(double value) {
+  return std::isfinite(value) && std::abs(value) <= FLT_MAX;
+}
+
+S21Matrix S21Matrix::SolveRefined(const S21Matrix& rhs) const {
+  if (rows_ != cols_) throw NonSquareMatrixException();
+  if (cols_ != rhs.rows_) throw ColumnRowMismatchException();
+
+  S21Matrix solution(rows_, rhs.cols_);
+  if (!SolveRefinedInto(rhs, solution)) throw DeterminantZeroException();
+  return solution;
+}
+
+bool S21Matrix::SolveRefinedInto(const S21Matrix& rhs,
+                                 S21Matrix& solution) const {
+  const int size = rows_;
+  const int rhs_cols = rhs.cols_;
+  const int total = size * rhs_cols;
+  std::vector<int> pivots(size);
+
+  // Right-hand side and solution are kept column-major for lu_solve.
+  std::vector<double> b(total), x(total), residual(total);
+  for (int row = 0; row < size; ++row) {
+    for (int col = 0; col < rhs_cols; ++col) {
+      b[col * size + row] = rhs.matrix_[row * rhs_cols + col];
+    }
+  }
+
+  double a_norm = 0.0;
+  bool single = true;
+  for (int row = 0; row < size; ++row) {
+    double row_sum = kernel_asum(matrix_ + row * size, size);
+    if (row_sum > a_norm) a_norm = row_sum;
+    if (!fits_float(row_sum)) single = false;
+  }
+  for (int i = 0; i < total && single; ++i) single = fits_float(b[i]);
+
+  bool converged = false;
+  if (single) {
+    std::vector<float> lu(size * size), work(total);
+    for (int i = 0; i < size * size; ++i) lu[i] = (float)matrix_[i];
+    if (lu_decompose(lu.data(), size, pivots.data())) {
+      for (int i = 0; i < total; ++i) work[i] = (float)b[i];
+      lu_solve(lu.data(), size, pivots.data(), work.data(), rhs_cols);
+      for (int i = 0; i < total; ++i) x[i] = work[i];
+
+      const double tolerance = a_norm * DBL_EPSILON * std::sqrt((double)size);
+      double prev_norm = std::numeric_limits<double>::infinity();
+      for (int iter = 0; iter <= REFINE_MAX_ITER && !converged; ++iter) {
+        // one pass over A per step, each row is reused for every column
+        for (int row = 0; row < size; ++row) {
+          const double* a_row = matrix_ + row * size;
+          for (int col = 0; col < rhs_cols; ++col) {
+            residual[col * size + row] =
+                b[col * size + row] -
+                kernel_dot(a_row, x.data() + col * size, size);
+          }
+        }
+        double r_norm = inf_norm(residual.data(), total);
+        if (r_norm <= tolerance * inf_norm(x.data(), total)) {
+          converged = true;
+        } else if (iter == REFINE_MAX_ITER || !fits_float(r_norm) ||
+                   r_norm > REFINE_MIN_CONTRACTION * prev_norm) {
+          break;
+        } else {
+          prev_norm = r_norm;
+          for (int i = 0; i < total; ++i) work[i] = (float)residual[i];
+          lu_solve(lu.data(), size, pivots.data(), work.data(), rhs_cols);
+          for (int i = 0; i < total; ++i) x[i] += work[i];
+        }
+      }
+    }
+  }
+
+  if (!converged) {
+    std::vector<double> lu(matrix_, matrix_ + size * size);
+    if (lu_decompose(lu.data(), size, pivots.data())) {
+      x = b;
+      lu_solve(lu.data(), size, pivots.data(), x.data(), rhs_cols);
+    } else if (std::isfinite(kernel_max_abs(lu.data(), size * size))) {
+      return false;
+    } else {
+      // non-finite A: NaN solution rather than a singularity error
+      x.assign(total, std::numeric_limits<double>::quiet_NaN());
+    }
+  }
+
+  for (int row = 0; row < size; ++row) {
+    for (int col = 0; col < rhs_cols; ++col) {
+      solution.matrix_[row * rhs_cols + col] = x[col * size + row];
+    }
+  }
+  solution.hash_ = HASH_UNSET;
+  return true;
+}
@@ -0,0 +1,125 @@
+#ifndef S21_STRUCTURED_H
+#define S21_STRUCTURED_H
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Square matrices with a known sparsity pattern. Each type stores only the
+// structurally nonzero part and provides multiply, solve and determinant
+// kernels that never touch the implicit zeros. Indexing is 1-based like
+// S21Matrix; elements outside the structure read as zero and cannot be
+// mutated.
+
+class S21DiagonalMatrix {
+ private:
+  std::vector<double> diagonal_;
+  int size_;
+
+  friend S21Matrix operator*(const S21Matrix& lhs,
+                             const S21DiagonalMatrix& rhs);
+
+ public:
+  S21DiagonalMatrix(int size);
+
+  int get_matrix_size() const noexcept;
+  double get_matrix_element(int row, int col) const;
+  void mutate_matrix_element(int row, int col, double val);
+
+  S21Matrix ToDense() const;
+  S21Matrix operator*(const S21Matrix& other) const;  // O(n * cols)
+  S21Matrix Solve(const S21Matrix& rhs) const;        // O(n * cols)
+  double Determinant() const noexcept;                // O(n)
+};
+
+// General band matrix with `lower` subdiagonals and `upper` superdiagonals,
+// a tridiagonal matrix is S21BandedMatrix(size, 1, 1). Solve and Determinant
+// run a banded LU with partial pivoting in O(n * lower * (lower + upper)).
+class S21BandedMatrix {
+ private:
+  std::vector<double> band_;
+  int size_;
+  int lower_;
+  int upper_;
+
+  bool Factorize(std::vector<double>& work, std::vector<double>& multipliers,
+                 std::vector<int>& pivots) const;
+
+  friend S21Matrix operator*(const S21Matrix& lhs, const S21BandedMatrix& rhs);
+
+ public:
+  S21BandedMatrix(int size, int lower, int upper);
+
+  int get_matrix_size() const noexcept;
+  int get_lower_bandwidth() const noexcept;
+  int get_upper_bandwidth() const noexcept;
+  double get_matrix_element(int row, int col) const;
+  void mutate_matrix_element(int row, int col, double val);
+
+  S21Matrix ToDense() const;
+  S21Matrix operator*(const S21Matrix& other) const;
+  S21Matrix Solve(const S21Matrix& rhs) const;
+  double Determinant() const;
+};
+
+// Upper or lower triangular matrix in row-major packed storage,
+// n * (n + 1) / 2 elements.
+class S21TriangularMatrix {
+ private:
+  std::vector<double> packed_;
+  int size_;
+  bool upper_;
+
+  int RowStart(int row) const;  // 0-based row, index of its first element
+
+  friend S21Matrix operator*(const S21Matrix& lhs,
+                             const S21TriangularMatrix& rhs);
+
+ public:
+  S21TriangularMatrix(int size, bool upper);
+
+  int get_matrix_size() const noexcept;
+  bool is_upper() const noexcept;
+  double get_matrix_element(int row, int col) const;
+  void mutate_matrix_element(int row, int col, double val);
+
+  S21Matrix ToDense() const;
+  S21Matrix operator*(const S21Matrix& other) const;
+  S21Matrix Solve(const S21Matrix& rhs) const;  // substitution, O(n^2 * cols)
+  double Determinant() const noexcept;          // O(n)
+};
+
+// Symmetric matrix storing only its lower triangle, packed row by row.
+// Mutating (i, j) also changes (j, i). Solve and Determinant try a packed
+// Cholesky factorization first and fall back to a dense LU for matrices that
+// are not positive definite.
+class S21SymmetricMatrix {
+ private:
+  std::vector<double> packed_;
+  int size_;
+
+  bool Cholesky(std::vector<double>& factor) const;
+
+  friend S21Matrix operator*(const S21Matrix& lhs,
+                             const S21SymmetricMatrix& rhs);
+
+ public:
+  S21SymmetricMatrix(int size);
+
+  int get_matrix_size() const noexcept;
+  double get_matrix_element(int row, int col) const;
+  void mutate_matrix_element(int row, int col, double val);
+
+  S21Matrix ToDense() const;
+  S21Matrix operator*(const S21Matrix& other) const;
+  S21Matrix Solve(const S21Matrix& rhs) const;
+  double Determinant() const;
+};
+
+// dense * structured
+S21Matrix operator*(const S21Matrix& lhs, const S21DiagonalMatrix& rhs);
+S21Matrix operator*(const S21Matrix& lhs, const S21BandedMatrix& rhs);
+S21Matrix operator*(const S21Matrix& lhs, const S21TriangularMatrix& rhs);
+S21Matrix operator*(const S21Matrix& lhs, const S21SymmetricMatrix& rhs);
+
+#endif
@@ -0,0 +1,134 @@
+#include <algorithm>
+
+#include "s21_exceptions.h"
+#include "s21_kernels.h"
+#include "s21_structured.h"
+
+// Row i of the lower triangle starts at packed_[i * (i + 1) / 2].
+
+S21SymmetricMatrix::S21SymmetricMatrix(int size) : size_(size) {
+  if (size_ < 1) throw IndexOutOfBoundsException();
+  packed_.assign(size_ * (size_ + 1) / 2, 0.0);
+}
+
+int S21SymmetricMatrix::get_matrix_size() const noexcept { return size_; }
+
+double S21SymmetricMatrix::get_matrix_element(int row, int col) const {
+  if (row < 1 || col < 1 || row > size_ || col > size_) {
+    throw IndexOutOfBoundsException();
+  }
+  if (col > row) std::swap(row, col);
+  return packed_[(row - 1) * row / 2 + col - 1];
+}
+
+void S21SymmetricMatrix::mutate_matrix_element(int row, int col, double val) {
+  if (row < 1 || col < 1 || row > size_ || col > size_) {
+    throw IndexOutOfBoundsException();
+  }
+  if (col > row) std::swap(row, col);
+  packed_[(row - 1) * row / 2 + col - 1] = val;
+}
+
+S21Matrix S21SymmetricMatrix::ToDense() const {
+  S21Matrix dense(size_, size_);
+  for (int i = 0; i < size_; ++i) {
+    const double *row = packed_.data() + i * (i + 1) / 2;
+    for (int j = 0; j <= i; ++j) {
+      dense.matrix_[i * size_ + j] = row[j];
+      dense.matrix_[j * size_ + i] = row[j];
+    }
+  }
+  return dense;
+}
+
+// Each stored off-diagonal element contributes to two rows of the result.
+S21Matrix S21SymmetricMatrix::operator*(const S21Matrix &other) const {
+  if (size_ != other.rows_) throw ColumnRowMismatchException();
+  const int cols = other.cols_;
+  S21Matrix result(size_, cols);
+  const double *b = other.matrix_;
+  double *c = result.matrix_;
+  for (int i = 0; i < size_; ++i) {
+    const double *row = packed_.data() + i * (i + 1) / 2;
+    for (int j = 0; j < i; ++j) {
+      kernel_axpy(row[j], b + j * cols, c + i * cols, cols);
+      kernel_axpy(row[j], b + i * cols, c + j * cols, cols);
+    }
+    kernel_axpy(row[i], b + i * cols, c + i * cols, cols);
+  }
+  return result;
+}
+
+S21Matrix operator*(const S21Matrix &lhs, const S21SymmetricMatrix &rhs) {
+  if (lhs.cols_ != rhs.size_) throw ColumnRowMismatchException();
+  const int size = rhs.size_;
+  S21Matrix result(lhs.rows_, size);
+  for (int r = 0; r < lhs.rows_; ++r) {
+    const double *a = lhs.matrix_ + r * size;
+    double *c = result.matrix_ + r * size;
+    for (int i = 0; i < size; ++i) {
+      const double *row = rhs.packed_.data() + i * (i + 1) / 2;
+      kernel_axpy(a[i], row, c, i);
+      c[i] += kernel_dot(a, row, i) + a[i] * row[i];
+    }
+  }
+  return result;
+}
+
+// Packed Cholesky A = L * L^T, returns false if A is not positive definite.
+bool S21SymmetricMatrix::Cholesky(std::vector<double> &factor) const {
+  factor = packed_;
+  for (int i = 0; i < size_; ++i) {
+    double *row_i = factor.data() + i * (i + 1) / 2;
+    for (int j = 0; j <= i; ++j) {
+      const double *row_j = factor.data() + j * (j + 1) / 2;
+      double sum = row_i[j] - kernel_dot(row_i, row_j, j);
+      if (j == i) {
+        if (!(sum > 0.0) || !std::isfinite(sum)) return false;
+        row_i[i] = std::sqrt(sum);
+      } else {
+        row_i[j] = sum / row_j[j];
+      }
+    }
+  }
+  return true;
+}
+
+S21Matrix S21SymmetricMatrix::Solve(const S21Matrix &rhs) const {
+  if (size_ != rhs.rows_) throw ColumnRowMismatchException();
+  std::vector<double> factor;
+  if (!Cholesky(factor)) return ToDense().SolveRefined(rhs);
+
+  const int cols = rhs.cols_;
+  S21Matrix result(rhs);
+  double *x = result.matrix_;
+  for (int i = 0; i < size_; ++i) {
+    const double *row = factor.data() + i * (i + 1) / 2;
+    for (int j = 0; j < i; ++j) {
+      kernel_axpy(-row[j], x + j * cols, x + i * cols, cols);
+    }
+    for (int col = 0; col < cols; ++col) x[i * cols + col] /= row[i];
+  }
+  for (int i = size_ - 1; i >= 0; --i) {
+    const double *row = factor.data() + i * (i + 1) / 2;
+    for (int col = 0; col < cols; ++col) x[i * cols + col] /= row[i];
+    for (int j = 0; j < i; ++j) {
+      kernel_axpy(-row[j], x + i * cols, x + j * cols, cols);
+    }
+  }
+  return result;
+}
+
+double S21SymmetricMatrix::Determinant() const {
+  std::vector<double> factor;
+  if (!Cholesky(factor)) {
+    S21LogDeterminant log_det = ToDense().LogDeterminant(true);
+    return log_det.sign * std::exp(log_det.log_abs);
+  }
+  double det = 1.0;
+  for (int i = 0; i < size_; ++i) {
+    double pivot = factor[i * (i + 1) / 2 + i];
+    det *= pivot * pivot;
+  }
+  return det;
+}
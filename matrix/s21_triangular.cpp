@@ -0,0 +1,107 @@
+#include "s21_exceptions.h"
+#include "s21_kernels.h"
+#include "s21_structured.h"
+
+// Upper rows keep columns row .. size_ - 1, lower rows keep 0 .. row.
+
+S21TriangularMatrix::S21TriangularMatrix(int size, bool upper)
+    : size_(size), upper_(upper) {
+  if (size_ < 1) throw IndexOutOfBoundsException();
+  packed_.assign(size_ * (size_ + 1) / 2, 0.0);
+}
+
+int S21TriangularMatrix::RowStart(int row) const {
+  return upper_ ? row * size_ - row * (row - 1) / 2 : row * (row + 1) / 2;
+}
+
+int S21TriangularMatrix::get_matrix_size() const noexcept { return size_; }
+
+bool S21TriangularMatrix::is_upper() const noexcept { return upper_; }
+
+double S21TriangularMatrix::get_matrix_element(int row, int col) const {
+  if (row < 1 || col < 1 || row > size_ || col > size_) {
+    throw IndexOutOfBoundsException();
+  }
+  if (upper_ ? col < row : col > row) return 0.0;
+  return packed_[RowStart(row - 1) + (upper_ ? col - row : col - 1)];
+}
+
+void S21TriangularMatrix::mutate_matrix_element(int row, int col, double val) {
+  if (row < 1 || col < 1 || row > size_ || col > size_ ||
+      (upper_ ? col < row : col > row)) {
+    throw IndexOutOfBoundsException();
+  }
+  packed_[RowStart(row - 1) + (upper_ ? col - row : col - 1)] = val;
+}
+
+S21Matrix S21TriangularMatrix::ToDense() const {
+  S21Matrix dense(size_, size_);
+  for (int i = 0; i < size_; ++i) {
+    int first = upper_ ? i : 0, last = upper_ ? size_ - 1 : i;
+    const double *row = packed_.data() + RowStart(i);
+    for (int j = first; j <= last; ++j) {
+      dense.matrix_[i * size_ + j] = row[j - first];
+    }
+  }
+  return dense;
+}
+
+S21Matrix S21TriangularMatrix::operator*(const S21Matrix &other) const {
+  if (size_ != other.rows_) throw ColumnRowMismatchException();
+  const int cols = other.cols_;
+  S21Matrix result(size_, cols);
+  for (int i = 0; i < size_; ++i) {
+    int first = upper_ ? i : 0, last = upper_ ? size_ - 1 : i;
+    const double *row = packed_.data() + RowStart(i);
+    for (int j = first; j <= last; ++j) {
+      kernel_axpy(row[j - first], other.matrix_ + j * cols,
+                  result.matrix_ + i * cols, cols);
+    }
+  }
+  return result;
+}
+
+S21Matrix operator*(const S21Matrix &lhs, const S21TriangularMatrix &rhs) {
+  if (lhs.cols_ != rhs.size_) throw ColumnRowMismatchException();
+  const int size = rhs.size_;
+  S21Matrix result(lhs.rows_, size);
+  for (int row = 0; row < lhs.rows_; ++row) {
+    double *result_row = result.matrix_ + row * size;
+    for (int i = 0; i < size; ++i) {
+      int first = rhs.upper_ ? i : 0, last = rhs.upper_ ? size - 1 : i;
+      kernel_axpy(lhs.matrix_[row * size + i],
+                  rhs.packed_.data() + rhs.RowStart(i), result_row + first,
+                  last - first + 1);
+    }
+  }
+  return result;
+}
+
+S21Matrix S21TriangularMatrix::Solve(const S21Matrix &rhs) const {
+  if (size_ != rhs.rows_) throw ColumnRowMismatchException();
+  const int cols = rhs.cols_;
+  S21Matrix result(rhs);
+  double *x = result.matrix_;
+  for (int step = 0; step < size_; ++step) {
+    int i = upper_ ? size_ - 1 - step : step;
+    int first = upper_ ? i : 0, last = upper_ ? size_ - 1 : i;
+    const double *row = packed_.data() + RowStart(i);
+    double pivot = row[i - first];
+    if (pivot == 0.0) throw DeterminantZeroException();
+    for (int j = first; j <= last; ++j) {
+      if (j != i) {
+        kernel_axpy(-row[j - first], x + j * cols, x + i * cols, cols);
+      }
+    }
+    for (int col = 0; col < cols; ++col) x[i * cols + col] /= pivot;
+  }
+  return result;
+}
+
+double S21TriangularMatrix::Determinant() const noexcept {
+  double det = 1.0;
+  for (int i = 0; i < size_; ++i) {
+    det *= packed_[RowStart(i) + (upper_ ? 0 : i)];
+  }
+  return det;
+}
@@ -0,0 +1,136 @@
+#include <new>
+
+#include "s21_matrix_oop.h"
+
+// Every Try* call runs the same checks as its throwing counterpart up front,
+// then delegates to it. After the checks the only exception left is
+// std::bad_alloc, which is reported as S21Status::kOutOfMemory.
+
+S21Result<S21Matrix> S21Matrix::TryCreate(int rows, int cols) noexcept {
+  if (rows < 1 || cols < 1) return S21Status::kIndexOutOfBounds;
+  try {
+    return S21Matrix(rows, cols);
+  } catch (const std::bad_alloc &) {
+    return S21Status::kOutOfMemory;
+  }
+}
+
+S21Result<double> S21Matrix::try_get_matrix_element(int row,
+                                                    int col) const noexcept {
+  if (row < 1 || col < 1 || row > rows_ || col > cols_) {
+    return S21Status::kIndexOutOfBounds;
+  }
+  return matrix_[cols_ * (row - 1) + col - 1];
+}
+
+S21Status S21Matrix::try_mutate_matrix_element(int row, int col,
+                                               double val) noexcept {
+  if (row < 1 || col < 1 || row > rows_ || col > cols_) {
+    return S21Status::kIndexOutOfBounds;
+  }
+  hash_ = HASH_UNSET;
+  matrix_[cols_ * (row - 1) + col - 1] = val;
+  return S21Status::kOk;
+}
+
+S21Status S21Matrix::try_mutate_number_of_rows(int rows) noexcept {
+  if (rows < 1) return S21Status::kIndexOutOfBounds;
+  try {
+    mutate_number_of_rows(rows);
+  } catch (const std::bad_alloc &) {
+    return S21Status::kOutOfMemory;
+  }
+  return S21Status::kOk;
+}
+
+S21Status S21Matrix::try_mutate_number_of_cols(int cols) noexcept {
+  if (cols < 1) return S21Status::kIndexOutOfBounds;
+  try {
+    mutate_number_of_cols(cols);
+  } catch (const std::bad_alloc &) {
+    return S21Status::kOutOfMemory;
+  }
+  return S21Status::kOk;
+}
+
+S21Status S21Matrix::TrySumMatrix(const S21Matrix &other) noexcept {
+  if (rows_ != other.rows_ || cols_ != other.cols_) {
+    return S21Status::kDimensionMismatch;
+  }
+  SumMatrix(other);
+  return S21Status::kOk;
+}
+
+S21Status S21Matrix::TrySubMatrix(const S21Matrix &other) noexcept {
+  if (rows_ != other.rows_ || cols_ != other.cols_) {
+    return S21Status::kDimensionMismatch;
+  }
+  SubMatrix(other);
+  return S21Status::kOk;
+}
+
+S21Status S21Matrix::TryMulMatrix(const S21Matrix &other) noexcept {
+  if (cols_ != other.rows_) return S21Status::kColumnRowMismatch;
+  try {
+    MulMatrix(other);
+  } catch (const std::bad_alloc &) {
+    return S21Status::kOutOfMemory;
+  }
+  return S21Status::kOk;
+}
+
+S21Result<double> S21Matrix::TryDeterminant() noexcept {
+  if (rows_ != cols_) return S21Status::kNonSquare;
+  try {
+    return Determinant();
+  } catch (const std::bad_alloc &) {
+    return S21Status::kOutOfMemory;
+  }
+}
+
+S21Result<S21LogDeterminant> S21Matrix::TryLogDeterminant(
+    bool overwrite) noexcept {
+  if (rows_ != cols_) return S21Status::kNonSquare;
+  try {
+    return LogDeterminant(overwrite);
+  } catch (const std::bad_alloc &) {
+    return S21Status::kOutOfMemory;
+  }
+}
+
+// The minors of a 1x1 matrix are empty, CalcComplements rejects it as an
+// out-of-bounds 0x0 matrix.
+S21Result<S21Matrix> S21Matrix::TryCalcComplements() noexcept {
+  if (rows_ != cols_) return S21Status::kNonSquare;
+  if (rows_ == 1) return S21Status::kIndexOutOfBounds;
+  try {
+    return CalcComplements();
+  } catch (const std::bad_alloc &) {
+    return S21Status::kOutOfMemory;
+  }
+}
+
+S21Result<S21Matrix> S21Matrix::TryInverseMatrix() noexcept {
+  if (rows_ != cols_) return S21Status::kNonSquare;
+  try {
+    S21Matrix inverse(rows_, cols_);
+    S21Status status = InverseInto(inverse);
+    if (status != S21Status::kOk) return status;
+    return inverse;
+  } catch (const std::bad_alloc &) {
+    return S21Status::kOutOfMemory;
+  }
+}
+
+S21Result<S21Matrix> S21Matrix::TrySolveRefined(
+    const S21Matrix &rhs) const noexcept {
+  if (rows_ != cols_) return S21Status::kNonSquare;
+  if (cols_ != rhs.rows_) return S21Status::kColumnRowMismatch;
+  try {
+    S21Matrix solution(rows_, rhs.cols_);
+    if (!SolveRefinedInto(rhs, solution)) return S21Status::kDeterminantZero;
+    return solution;
+  } catch (const std::bad_alloc &) {
+    return S21Status::kOutOfMemory;
+  }
+}
@@ -1,12 +1,19 @@
 #include <gtest/gtest.h>
 
+#include <climits>
+#include <cmath>
+#include <thread>
+
+#include "s21_cache.h"
 #include "s21_exceptions.h"
 #include "s21_matrix_oop.h"
+#include "s21_structured.h"
 #include "stdio.h"
 
 #define EPS 1e-7
 
 void generate_elements(S21Matrix& matrix);
+void expect_matrix_near(const S21Matrix& matrix1, const S21Matrix& matrix2);
 
 int main() {
   testing::InitGoogleTest();
@@ -23,6 +30,17 @@ void generate_elements(S21Matrix& matrix) {
   }
 }
 
+void expect_matrix_near(const S21Matrix& matrix1, const S21Matrix& matrix2) {
+  ASSERT_EQ(matrix1.get_matrix_rows(), matrix2.get_matrix_rows());
+  ASSERT_EQ(matrix1.get_matrix_cols(), matrix2.get_matrix_cols());
+  for (int row = 1; row <= matrix1.get_matrix_rows(); row++) {
+    for (int col = 1; col <= matrix1.get_matrix_cols(); col++) {
+      EXPECT_GE(EPS, abs(matrix1.get_matrix_element(row, col) -
+                         matrix2.get_matrix_element(row, col)));
+    }
+  }
+}
+
 TEST(constructor, standart_constructor) {
   S21Matrix matrix;
   EXPECT_EQ(3, matrix.get_matrix_rows());
@@ -454,3 +472,461 @@ TEST(index_operator, index_operator_work) {
   EXPECT_GE(EPS, abs(matrix(3, 3) - 9.));
   EXPECT_GE(EPS, abs(matrix(2, 2) - 5.));
 }
+
+TEST(solve_refined, solve_refined_work) {
+  S21Matrix matrix;
+  generate_elements(matrix);
+  matrix.mutate_matrix_element(3, 3, 10);
+  S21Matrix rhs{3, 2};
+  generate_elements(rhs);
+  S21Matrix solution = matrix.SolveRefined(rhs);
+  S21Matrix check = matrix * solution;
+  for (int row = 1; row <= 3; row++) {
+    for (int col = 1; col <= 2; col++) {
+      EXPECT_GE(EPS, abs(check(row, col) - rhs(row, col)));
+    }
+  }
+  EXPECT_GE(EPS, abs(solution(1, 1) - 1. / 3.));
+  EXPECT_GE(EPS, abs(solution(3, 1)));
+  S21Matrix hilbert{10, 10};
+  S21Matrix ones{10, 1};
+  for (int row = 1; row <= 10; row++) {
+    for (int col = 1; col <= 10; col++) {
+      hilbert.mutate_matrix_element(row, col, 1. / (row + col - 1));
+    }
+    ones.mutate_matrix_element(row, 1, 1);
+  }
+  S21Matrix hilbert_rhs = hilbert * ones;
+  S21Matrix hilbert_solution = hilbert.SolveRefined(hilbert_rhs);
+  for (int row = 1; row <= 10; row++) {
+    EXPECT_GE(1e-2, abs(hilbert_solution(row, 1) - 1.));
+  }
+  S21Matrix singular_matrix;
+  EXPECT_THROW(singular_matrix.SolveRefined(rhs), DeterminantZeroException);
+  S21Matrix error_matrix{1, 2};
+  EXPECT_THROW(error_matrix.SolveRefined(rhs), NonSquareMatrixException);
+  EXPECT_THROW(matrix.SolveRefined(error_matrix), ColumnRowMismatchException);
+  S21Matrix poisoned(matrix);
+  poisoned.mutate_matrix_element(1, 1, NAN);
+  EXPECT_TRUE(std::isnan(poisoned.SolveRefined(rhs)(2, 1)));
+}
+
+TEST(log_determinant, log_determinant_work) {
+  S21Matrix matrix;
+  generate_elements(matrix);
+  matrix.mutate_matrix_element(3, 3, 1);
+  S21LogDeterminant log_det = matrix.LogDeterminant();
+  EXPECT_DOUBLE_EQ(1, log_det.sign);
+  EXPECT_GE(EPS, abs(log_det.log_abs - std::log(24.)));
+  matrix.mutate_matrix_element(1, 1, 10);
+  EXPECT_DOUBLE_EQ(-1, matrix.LogDeterminant().sign);
+  EXPECT_GE(EPS, abs(matrix.LogDeterminant().log_abs - std::log(363.)));
+  S21Matrix singular_matrix;
+  EXPECT_DOUBLE_EQ(0, singular_matrix.LogDeterminant().sign);
+  S21Matrix big_matrix{150, 150};
+  for (int i = 1; i <= 150; i++) {
+    big_matrix.mutate_matrix_element(i, i, 1000);
+    big_matrix.mutate_matrix_element(i, 151 - i, 1);
+  }
+  big_matrix.mutate_matrix_element(1, 1, -1000);
+  S21LogDeterminant big_log_det = big_matrix.LogDeterminant(true);
+  EXPECT_DOUBLE_EQ(-1, big_log_det.sign);
+  EXPECT_GE(1e-6, abs(big_log_det.log_abs - 74 * std::log(1e6 - 1) -
+                      std::log(1e6 + 1)));
+  EXPECT_DOUBLE_EQ(-1e-3, big_matrix(150, 1));
+  S21Matrix error_matrix{1, 2};
+  EXPECT_THROW(error_matrix.LogDeterminant(), NonSquareMatrixException);
+  for (double bad : {(double)NAN, (double)INFINITY}) {
+    S21Matrix poisoned{3, 3};
+    generate_elements(poisoned);
+    poisoned.mutate_matrix_element(2, 3, bad);
+    S21LogDeterminant poisoned_log_det = poisoned.LogDeterminant();
+    EXPECT_TRUE(std::isnan(poisoned_log_det.sign));
+    EXPECT_TRUE(std::isnan(poisoned_log_det.log_abs));
+  }
+  S21Matrix zero_column{2, 2};
+  zero_column.mutate_matrix_element(2, 2, NAN);
+  EXPECT_TRUE(std::isnan(zero_column.LogDeterminant().log_abs));
+}
+
+TEST(diagonal_matrix, diagonal_matrix_work) {
+  S21DiagonalMatrix diagonal{4};
+  for (int i = 1; i <= 4; i++) diagonal.mutate_matrix_element(i, i, i);
+  EXPECT_DOUBLE_EQ(0, diagonal.get_matrix_element(1, 2));
+  EXPECT_DOUBLE_EQ(3, diagonal.get_matrix_element(3, 3));
+  EXPECT_DOUBLE_EQ(24, diagonal.Determinant());
+  S21Matrix dense = diagonal.ToDense();
+  S21Matrix other{4, 3};
+  generate_elements(other);
+  expect_matrix_near(dense * other, diagonal * other);
+  S21Matrix left{3, 4};
+  generate_elements(left);
+  expect_matrix_near(left * dense, left * diagonal);
+  expect_matrix_near(other, dense * diagonal.Solve(other));
+  EXPECT_THROW(diagonal.mutate_matrix_element(1, 2, 1),
+               IndexOutOfBoundsException);
+  EXPECT_THROW(diagonal * left, ColumnRowMismatchException);
+  diagonal.mutate_matrix_element(2, 2, 0);
+  EXPECT_THROW(diagonal.Solve(other), DeterminantZeroException);
+}
+
+TEST(banded_matrix, banded_matrix_work) {
+  S21BandedMatrix tridiagonal{6, 1, 1};
+  for (int i = 1; i <= 6; i++) {
+    tridiagonal.mutate_matrix_element(i, i, i % 2 ? 0.5 : 4);
+    if (i > 1) tridiagonal.mutate_matrix_element(i, i - 1, 3 - i);
+    if (i < 6) tridiagonal.mutate_matrix_element(i, i + 1, i);
+  }
+  EXPECT_DOUBLE_EQ(0, tridiagonal.get_matrix_element(1, 3));
+  S21Matrix dense = tridiagonal.ToDense();
+  EXPECT_GE(EPS, abs(dense.Determinant() - tridiagonal.Determinant()));
+  S21Matrix other{6, 2};
+  generate_elements(other);
+  expect_matrix_near(dense * other, tridiagonal * other);
+  expect_matrix_near(other, dense * tridiagonal.Solve(other));
+  S21Matrix left{2, 6};
+  generate_elements(left);
+  expect_matrix_near(left * dense, left * tridiagonal);
+
+  S21BandedMatrix banded{7, 2, 1};
+  for (int row = 1; row <= 7; row++) {
+    for (int col = row - 2; col <= row + 1; col++) {
+      if (col >= 1 && col <= 7) {
+        banded.mutate_matrix_element(row, col, (row * 3 + col * 5) % 7 - 3);
+      }
+    }
+  }
+  S21Matrix banded_dense = banded.ToDense();
+  EXPECT_GE(EPS, abs(banded_dense.Determinant() - banded.Determinant()));
+  S21Matrix rhs{7, 1};
+  generate_elements(rhs);
+  expect_matrix_near(rhs, banded_dense * banded.Solve(rhs));
+  EXPECT_THROW(banded.mutate_matrix_element(1, 4, 1),
+               IndexOutOfBoundsException);
+  EXPECT_THROW(S21BandedMatrix(3, 3, 0), IndexOutOfBoundsException);
+  S21BandedMatrix singular{3, 1, 1};
+  EXPECT_DOUBLE_EQ(0, singular.Determinant());
+  EXPECT_THROW(singular.Solve(rhs), ColumnRowMismatchException);
+  S21Matrix singular_rhs{3, 1};
+  generate_elements(singular_rhs);
+  EXPECT_THROW(singular.Solve(singular_rhs), DeterminantZeroException);
+}
+
+TEST(triangular_matrix, triangular_matrix_work) {
+  for (int upper = 0; upper <= 1; upper++) {
+    S21TriangularMatrix triangular{5, upper == 1};
+    for (int row = 1; row <= 5; row++) {
+      for (int col = 1; col <= 5; col++) {
+        if (upper ? col >= row : col <= row) {
+          double val = row == col ? 2 : row - col;
+          triangular.mutate_matrix_element(row, col, val);
+        }
+      }
+    }
+    EXPECT_DOUBLE_EQ(32, triangular.Determinant());
+    S21Matrix dense = triangular.ToDense();
+    S21Matrix other{5, 3};
+    generate_elements(other);
+    expect_matrix_near(dense * other, triangular * other);
+    expect_matrix_near(other, dense * triangular.Solve(other));
+    S21Matrix left{3, 5};
+    generate_elements(left);
+    expect_matrix_near(left * dense, left * triangular);
+    EXPECT_DOUBLE_EQ(0, triangular.get_matrix_element(upper ? 5 : 1,
+                                                      upper ? 1 : 5));
+    EXPECT_THROW(triangular.mutate_matrix_element(upper ? 5 : 1,
+                                                  upper ? 1 : 5, 1),
+                 IndexOutOfBoundsException);
+  }
+}
+
+TEST(symmetric_matrix, symmetric_matrix_work) {
+  S21SymmetricMatrix symmetric{5};
+  for (int row = 1; row <= 5; row++) {
+    for (int col = 1; col <= row; col++) {
+      symmetric.mutate_matrix_element(row, col, row == col ? 10 : row + col);
+    }
+  }
+  EXPECT_DOUBLE_EQ(3, symmetric.get_matrix_element(1, 2));
+  S21Matrix dense = symmetric.ToDense();
+  EXPECT_GE(1e-6, abs(dense.Determinant() - symmetric.Determinant()));
+  S21Matrix other{5, 2};
+  generate_elements(other);
+  expect_matrix_near(dense * other, symmetric * other);
+  expect_matrix_near(other, dense * symmetric.Solve(other));
+  S21Matrix left{2, 5};
+  generate_elements(left);
+  expect_matrix_near(left * dense, left * symmetric);
+  symmetric.mutate_matrix_element(1, 1, -10);
+  dense = symmetric.ToDense();
+  EXPECT_GE(1e-6, abs(dense.Determinant() - symmetric.Determinant()));
+  expect_matrix_near(other, dense * symmetric.Solve(other));
+}
+
+TEST(power, power_work) {
+  S21Matrix matrix;
+  generate_elements(matrix);
+  matrix.mutate_matrix_element(3, 3, 10);
+  matrix *= 0.1;
+  S21Matrix expected{3, 3};
+  for (int i = 1; i <= 3; i++) expected.mutate_matrix_element(i, i, 1);
+  expect_matrix_near(expected, matrix.Power(0));
+  for (int power = 1; power <= 7; power++) {
+    expected *= matrix;
+    expect_matrix_near(expected, matrix.Power(power));
+  }
+  S21Matrix inverse = matrix.Power(-1);
+  S21Matrix identity{3, 3};
+  for (int i = 1; i <= 3; i++) identity.mutate_matrix_element(i, i, 1);
+  expect_matrix_near(identity, matrix * inverse);
+  expect_matrix_near(inverse * inverse, matrix.Power(-2));
+  S21Matrix singular_matrix;
+  EXPECT_THROW(singular_matrix.Power(-1), DeterminantZeroException);
+  S21Matrix error_matrix{1, 2};
+  EXPECT_THROW(error_matrix.Power(2), NonSquareMatrixException);
+  S21Matrix reflection = identity * -1;
+  expect_matrix_near(identity, reflection.Power(INT_MIN));
+  expect_matrix_near(reflection, reflection.Power(INT_MAX));
+}
+
+TEST(exp, exp_work) {
+  S21Matrix diagonal{3, 3};
+  diagonal.mutate_matrix_element(1, 1, 1);
+  diagonal.mutate_matrix_element(2, 2, -2);
+  diagonal.mutate_matrix_element(3, 3, 0.001);
+  S21Matrix diagonal_exp = diagonal.Exp();
+  EXPECT_GE(EPS, abs(diagonal_exp(1, 1) - std::exp(1.)));
+  EXPECT_GE(EPS, abs(diagonal_exp(2, 2) - std::exp(-2.)));
+  EXPECT_GE(EPS, abs(diagonal_exp(3, 3) - std::exp(0.001)));
+  EXPECT_GE(EPS, abs(diagonal_exp(1, 2)));
+  S21Matrix nilpotent{2, 2};
+  nilpotent.mutate_matrix_element(1, 2, 1);
+  S21Matrix nilpotent_exp = nilpotent.Exp();
+  EXPECT_GE(EPS, abs(nilpotent_exp(1, 1) - 1));
+  EXPECT_GE(EPS, abs(nilpotent_exp(1, 2) - 1));
+  EXPECT_GE(EPS, abs(nilpotent_exp(2, 1)));
+  S21Matrix rotation{2, 2};
+  rotation.mutate_matrix_element(1, 2, -10);
+  rotation.mutate_matrix_element(2, 1, 10);
+  S21Matrix rotation_exp = rotation.Exp();
+  EXPECT_GE(EPS, abs(rotation_exp(1, 1) - std::cos(10.)));
+  EXPECT_GE(EPS, abs(rotation_exp(2, 1) - std::sin(10.)));
+  EXPECT_GE(EPS, abs(rotation_exp(1, 2) + std::sin(10.)));
+  S21Matrix error_matrix{1, 2};
+  EXPECT_THROW(error_matrix.Exp(), NonSquareMatrixException);
+  S21Matrix infinite{2, 2};
+  infinite.mutate_matrix_element(1, 2, INFINITY);
+  S21Matrix infinite_exp = infinite.Exp();
+  EXPECT_TRUE(std::isnan(infinite_exp(1, 1)));
+  EXPECT_TRUE(std::isnan(infinite_exp(2, 2)));
+}
+
+TEST(polynomial, polynomial_work) {
+  S21Matrix matrix;
+  generate_elements(matrix);
+  matrix *= 0.1;
+  std::vector<double> coefficients;
+  S21Matrix expected{3, 3};
+  expect_matrix_near(expected, matrix.Polynomial(coefficients));
+  S21Matrix power{3, 3};
+  for (int i = 1; i <= 3; i++) power.mutate_matrix_element(i, i, 1);
+  for (int degree = 0; degree <= 10; degree++) {
+    double coefficient = degree % 3 - 1.5;
+    coefficients.push_back(coefficient);
+    expected += power * coefficient;
+    power *= matrix;
+    expect_matrix_near(expected, matrix.Polynomial(coefficients));
+  }
+  S21Matrix error_matrix{1, 2};
+  EXPECT_THROW(error_matrix.Polynomial(coefficients), NonSquareMatrixException);
+}
+
+TEST(matrix_cache, matrix_cache_work) {
+  S21MatrixCache& cache = S21MatrixCache::Instance();
+  EXPECT_FALSE(cache.IsEnabled());
+  cache.Enable(1 << 20);
+  cache.ResetStats();
+  S21Matrix matrix;
+  generate_elements(matrix);
+  matrix.mutate_matrix_element(3, 3, 10);
+  S21Matrix inverse = matrix.InverseMatrix();
+  expect_matrix_near(inverse, matrix.InverseMatrix());
+  S21Matrix copy(matrix);
+  expect_matrix_near(inverse, copy.InverseMatrix());
+  EXPECT_EQ(2u, cache.GetStats().hits);
+  EXPECT_EQ(1u, cache.GetStats().misses);
+  EXPECT_EQ(1u, cache.GetStats().entries);
+
+  EXPECT_DOUBLE_EQ(-3, matrix.Determinant());
+  EXPECT_DOUBLE_EQ(-3, matrix.Determinant());
+  matrix.mutate_matrix_element(3, 3, 1);
+  EXPECT_DOUBLE_EQ(24, matrix.Determinant());
+  S21Matrix complements = matrix.CalcComplements();
+  expect_matrix_near(complements, matrix.CalcComplements());
+  EXPECT_DOUBLE_EQ(-43, complements.get_matrix_element(1, 1));
+  matrix.mutate_number_of_rows(2);
+  EXPECT_THROW(matrix.Determinant(), NonSquareMatrixException);
+  matrix.mutate_number_of_cols(2);
+  EXPECT_DOUBLE_EQ(-3, matrix.Determinant());
+  EXPECT_EQ(4u, cache.GetStats().hits);
+  EXPECT_EQ(6u, cache.GetStats().misses);
+
+  cache.Enable(cache.GetStats().bytes / 2);
+  EXPECT_LT(0u, cache.GetStats().evictions);
+  EXPECT_GE(cache.GetStats().capacity, cache.GetStats().bytes);
+  cache.Disable();
+  EXPECT_EQ(0u, cache.GetStats().entries);
+  EXPECT_DOUBLE_EQ(-3, matrix.Determinant());
+  EXPECT_EQ(6u, cache.GetStats().misses);
+
+  cache.Enable(1 << 20);
+  cache.ResetStats();
+  S21Matrix poisoned(matrix);
+  poisoned.mutate_matrix_element(1, 1, NAN);
+  for (int i = 0; i < 5; i++) poisoned.Determinant();
+  EXPECT_EQ(4u, cache.GetStats().hits);
+  EXPECT_EQ(1u, cache.GetStats().entries);
+  cache.Disable();
+
+  const S21Matrix shared = matrix;
+  std::uint64_t hashes[4] = {};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([&shared, &hashes, i] {
+      hashes[i] = shared.get_content_hash();
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  for (int i = 0; i < 4; i++) EXPECT_EQ(matrix.get_content_hash(), hashes[i]);
+}
+
+TEST(reductions, reductions_work) {
+  S21Matrix matrix{3, 4};
+  generate_elements(matrix);
+  matrix.mutate_matrix_element(2, 3, -7);
+  EXPECT_DOUBLE_EQ(12, matrix.MaxAbs());
+  EXPECT_DOUBLE_EQ(24, matrix.OneNorm());
+  EXPECT_DOUBLE_EQ(42, matrix.InfNorm());
+  S21Matrix row_sums = matrix.RowSums();
+  EXPECT_EQ(3, row_sums.get_matrix_rows());
+  EXPECT_DOUBLE_EQ(10, row_sums(1, 1));
+  EXPECT_DOUBLE_EQ(12, row_sums(2, 1));
+  EXPECT_DOUBLE_EQ(42, row_sums(3, 1));
+  S21Matrix col_sums = matrix.ColSums();
+  EXPECT_EQ(4, col_sums.get_matrix_cols());
+  EXPECT_DOUBLE_EQ(15, col_sums(1, 1));
+  EXPECT_DOUBLE_EQ(7, col_sums(1, 3));
+  EXPECT_DOUBLE_EQ(matrix.Dot(matrix),
+                   matrix.FrobeniusNorm() * matrix.FrobeniusNorm());
+  S21Matrix square;
+  generate_elements(square);
+  EXPECT_DOUBLE_EQ(15, square.Trace());
+  EXPECT_THROW(matrix.Trace(), NonSquareMatrixException);
+  EXPECT_THROW(matrix.Dot(square), DimensionMismatchException);
+  S21Matrix huge{2, 2};
+  huge.mutate_matrix_element(1, 1, 3e200);
+  huge.mutate_matrix_element(2, 2, 4e200);
+  EXPECT_DOUBLE_EQ(5e200, huge.FrobeniusNorm());
+  S21Matrix big{700, 500};
+  for (int row = 1; row <= 700; row++) {
+    for (int col = 1; col <= 500; col++) {
+      big.mutate_matrix_element(row, col, (row + col) % 2 ? 0.1 : -0.1);
+    }
+  }
+  EXPECT_GE(1e-9, abs(big.FrobeniusNorm() - std::sqrt(3500.)));
+  EXPECT_GE(1e-9, abs(big.OneNorm() - 70));
+  EXPECT_GE(1e-9, abs(big.ColSums()(1, 500)));
+  for (int position = 0; position < 4; position++) {
+    S21Matrix poisoned{2, 2};
+    poisoned.mutate_matrix_element(1, 1, 5);
+    poisoned.mutate_matrix_element(position / 2 + 1, position % 2 + 1, NAN);
+    EXPECT_TRUE(std::isnan(poisoned.MaxAbs()));
+    EXPECT_TRUE(std::isnan(poisoned.FrobeniusNorm()));
+    EXPECT_TRUE(std::isnan(poisoned.OneNorm()));
+    EXPECT_TRUE(std::isnan(poisoned.InfNorm()));
+  }
+  big.mutate_matrix_element(700, 500, NAN);
+  EXPECT_TRUE(std::isnan(big.MaxAbs()));
+  EXPECT_TRUE(std::isnan(big.FrobeniusNorm()));
+  EXPECT_TRUE(std::isnan(big.OneNorm()));
+  EXPECT_TRUE(std::isnan(big.InfNorm()));
+}
+
+TEST(approx_equal, approx_equal_work) {
+  S21Matrix matrix1;
+  S21Matrix matrix2;
+  generate_elements(matrix1);
+  generate_elements(matrix2);
+  EXPECT_TRUE(matrix1.ApproxEqual(matrix2));
+  matrix2.mutate_matrix_element(3, 3, 9 + 1e-6);
+  EXPECT_TRUE(matrix1.ApproxEqual(matrix2));
+  EXPECT_FALSE(matrix1.ApproxEqual(matrix2, 0, 1e-9));
+  EXPECT_TRUE(matrix1.ApproxEqual(matrix2, 0, 1e-5));
+  matrix2.mutate_matrix_element(1, 1, NAN);
+  EXPECT_FALSE(matrix1.ApproxEqual(matrix2));
+  S21Matrix matrix3{2, 3};
+  EXPECT_FALSE(matrix1.ApproxEqual(matrix3));
+}
+
+TEST(try_api, try_api_work) {
+  static_assert(std::is_nothrow_move_constructible<S21Matrix>::value, "");
+  static_assert(std::is_nothrow_move_assignable<S21Matrix>::value, "");
+  S21Matrix matrix;
+  generate_elements(matrix);
+  S21Matrix matrix2{2, 3};
+  EXPECT_EQ(S21Status::kDimensionMismatch, matrix.TrySumMatrix(matrix2));
+  EXPECT_EQ(S21Status::kDimensionMismatch, matrix.TrySubMatrix(matrix2));
+  EXPECT_EQ(S21Status::kColumnRowMismatch, matrix.TryMulMatrix(matrix2));
+  EXPECT_EQ(S21Status::kNonSquare, matrix2.TryDeterminant().status());
+  EXPECT_EQ(S21Status::kNonSquare, matrix2.TryLogDeterminant().status());
+  EXPECT_EQ(S21Status::kNonSquare, matrix2.TryCalcComplements().status());
+  EXPECT_EQ(S21Status::kNonSquare, matrix2.TryInverseMatrix().status());
+  EXPECT_EQ(S21Status::kColumnRowMismatch,
+            matrix.TrySolveRefined(matrix2).status());
+  EXPECT_EQ(S21Status::kIndexOutOfBounds,
+            matrix.try_get_matrix_element(4, 1).status());
+  EXPECT_EQ(S21Status::kIndexOutOfBounds,
+            matrix.try_mutate_matrix_element(0, 1, 1));
+  EXPECT_EQ(S21Status::kIndexOutOfBounds, matrix.try_mutate_number_of_rows(0));
+  EXPECT_EQ(S21Status::kIndexOutOfBounds, matrix.try_mutate_number_of_cols(0));
+  EXPECT_EQ(S21Status::kIndexOutOfBounds, S21Matrix::TryCreate(0, 1).status());
+  EXPECT_FALSE(S21Matrix().TrySolveRefined(S21Matrix()));
+  EXPECT_EQ(S21Status::kDeterminantZero, matrix.TryInverseMatrix().status());
+  EXPECT_STREQ("Error: Determinant of the matrix is zero.",
+               S21StatusMessage(S21Status::kDeterminantZero));
+  S21Matrix single{1, 1};
+  single.mutate_matrix_element(1, 1, 2);
+  EXPECT_EQ(S21Status::kIndexOutOfBounds,
+            single.TryCalcComplements().status());
+
+  EXPECT_EQ(S21Status::kOk, matrix.TrySumMatrix(matrix));
+  EXPECT_DOUBLE_EQ(18, matrix.try_get_matrix_element(3, 3).value());
+  EXPECT_EQ(S21Status::kOk, matrix.try_mutate_number_of_cols(2));
+  EXPECT_EQ(S21Status::kOk, matrix.TryMulMatrix(matrix2));
+  EXPECT_EQ(3, matrix.get_matrix_cols());
+  S21Matrix regular{2, 2};
+  regular.mutate_matrix_element(1, 1, 2);
+  regular.mutate_matrix_element(1, 2, 1);
+  regular.mutate_matrix_element(2, 1, 1);
+  regular.mutate_matrix_element(2, 2, 1);
+  EXPECT_DOUBLE_EQ(1, regular.TryDeterminant().value());
+  EXPECT_DOUBLE_EQ(1, regular.TryLogDeterminant().value().sign);
+  S21Result<S21Matrix> inverse = regular.TryInverseMatrix();
+  ASSERT_TRUE(inverse);
+  EXPECT_DOUBLE_EQ(-1, inverse.value()(1, 2));
+  EXPECT_DOUBLE_EQ(2, inverse.value()(2, 2));
+  S21MatrixCache& cache = S21MatrixCache::Instance();
+  cache.Enable(1 << 20);
+  cache.ResetStats();
+  expect_matrix_near(inverse.value(), regular.TryInverseMatrix().value());
+  expect_matrix_near(inverse.value(), regular.InverseMatrix());
+  EXPECT_EQ(1u, cache.GetStats().entries);
+  EXPECT_EQ(1u, cache.GetStats().hits);
+  cache.Disable();
+  S21Result<S21Matrix> created = S21Matrix::TryCreate(2, 2);
+  ASSERT_TRUE(created.ok());
+  created.value().mutate_matrix_element(1, 1, 3);
+  S21Matrix solution = regular.TrySolveRefined(created.value()).value();
+  EXPECT_GE(EPS, abs(solution(1, 1) - 3));
+  EXPECT_GE(EPS, abs(solution(2, 1) + 3));
+}